@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+#include "CompactGraph.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <cstdint>
+
+TEST(CompactGraphBenchmark, MemoryAndQueryTime) {
+    const int side = 250;
+    Graph g = makeGridNetwork(side, 9, 500);
+    CompactRoadGraph compact = CompactRoadGraph::fromGraph(g);
+    const size_t arcs = static_cast<size_t>(g.getEdgeCount()) * 2;
+    const size_t graphBytes = (g.getVertexCount() + 1) * sizeof(int) + arcs * 2 * sizeof(int);
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    auto expected = g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap).getDistances();
+    double graphMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    start = Clock::now();
+    auto actual = compact.distancesFrom(0);
+    double compactMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    Benchmark benchmark;
+    benchmark.recordCounter("Graph CSR bytes", static_cast<double>(graphBytes));
+    benchmark.recordCounter("CompactRoadGraph bytes", static_cast<double>(compact.getMemoryBytes()));
+    benchmark.recordCounter("Graph full tree (ms)", graphMs);
+    benchmark.recordCounter("CompactRoadGraph full tree (ms)", compactMs);
+    benchmark.displayCounters();
+
+    EXPECT_LT(compact.getMemoryBytes(), graphBytes);
+    for (size_t v = 0; v < actual.size(); ++v) {
+        ASSERT_EQ(actual[v], static_cast<std::uint64_t>(expected[v]));
+    }
+}
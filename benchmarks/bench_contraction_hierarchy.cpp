@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "ContractionHierarchy.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <cstdlib>
+#include <vector>
+
+TEST(ContractionHierarchyBenchmark, QueryVersusDijkstra) {
+    Graph graph = makeGridNetwork(60, 9);
+    const int n = graph.getVertexCount();
+
+    Benchmark benchmark;
+    benchmark.runBenchmark("CH preprocessing", [&]() { ContractionHierarchy build(graph); }, n, 1);
+    ContractionHierarchy ch(graph);
+
+    SearchStats dijkstraStats, chStats;
+    int dijkstraDistance = 0, chDistance = 0;
+    benchmark.compareAlgorithms("Dijkstra query", [&]() {
+        dijkstraStats = SearchStats();
+        dijkstraDistance = graph.findShortestPath(0, n - 1, ShortestPathEngine::BinaryHeap,
+                                                  &dijkstraStats).first;
+    }, "CH query", [&]() {
+        chStats = SearchStats();
+        chDistance = ch.findShortestPath(0, n - 1, &chStats).first;
+    }, n, 20);
+
+    benchmark.recordCounter("Shortcuts added", ch.getShortcutCount());
+    benchmark.recordCounter("Settled (Dijkstra)", dijkstraStats.settledVertices);
+    benchmark.recordCounter("Settled (CH)", chStats.settledVertices);
+    benchmark.displayCounters();
+
+    EXPECT_EQ(chDistance, dijkstraDistance);
+    EXPECT_LT(chStats.settledVertices, dijkstraStats.settledVertices);
+}
+
+TEST(ContractionHierarchyBenchmark, DistanceTableVersusPointQueries) {
+    Graph graph = makeGridNetwork(80, 17);
+    const int n = graph.getVertexCount();
+    ContractionHierarchy ch(graph);
+
+    srand(19);
+    std::vector<int> depots(20), sites(200);
+    for (int& v : depots) v = rand() % n;
+    for (int& v : sites) v = rand() % n;
+
+    Benchmark benchmark;
+    std::vector<int> pointTable(depots.size() * sites.size());
+    std::vector<int> bucketTable, searchTable;
+    benchmark.compareAlgorithms("S x T CH point queries", [&]() {
+        for (size_t i = 0; i < depots.size(); ++i) {
+            for (size_t j = 0; j < sites.size(); ++j) {
+                pointTable[i * sites.size() + j] = ch.findShortestDistance(depots[i], sites[j]);
+            }
+        }
+    }, "CH bucket many-to-many", [&]() {
+        bucketTable = ch.computeDistanceTable(depots, sites);
+    }, depots.size() * sites.size(), 3);
+    benchmark.runBenchmark("Graph::computeDistanceTable", [&]() {
+        searchTable = graph.computeDistanceTable(depots, sites);
+    }, depots.size() * sites.size(), 3);
+
+    EXPECT_EQ(bucketTable, pointTable);
+    EXPECT_EQ(searchTable, pointTable);
+}
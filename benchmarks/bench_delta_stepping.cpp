@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include "DeltaStepping.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+
+TEST(DeltaSteppingBenchmark, ThreadScaling) {
+    Graph g = makeGridNetwork(150, 21, 100);
+    const int n = g.getVertexCount();
+    std::vector<int> expected =
+        g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap).getDistances();
+
+    using Clock = std::chrono::steady_clock;
+    Benchmark benchmark;
+    auto start = Clock::now();
+    g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap);
+    benchmark.recordCounter("Dijkstra (ms)",
+                            std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+
+    unsigned maxThreads = std::max(4u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        DeltaStepping solver(g, 0, threads);
+        start = Clock::now();
+        ShortestPathTree tree = solver.computeShortestPathTree(0);
+        double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        benchmark.recordCounter("Delta-stepping, " + std::to_string(threads) + " threads (ms)",
+                                elapsed);
+        EXPECT_EQ(tree.getDistances(), expected);
+    }
+    benchmark.recordCounter("Vertices", n);
+    benchmark.displayCounters();
+}
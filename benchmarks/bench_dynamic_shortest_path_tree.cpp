@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "DynamicShortestPathTree.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+
+TEST(DynamicShortestPathTreeBenchmark, ClosureRepairVersusRecompute) {
+    Graph g = makeGridNetwork(60, 23);
+    const int n = g.getVertexCount();
+    DynamicShortestPathTree tree(g, 0);
+
+    // Close or slow down random roads, as a batch of construction plans would
+    srand(8);
+    using Clock = std::chrono::steady_clock;
+    const int edits = 100;
+    long long updated = 0;
+    double repairMs = 0, recomputeMs = 0;
+    for (int edit = 0; edit < edits; ++edit) {
+        int u = rand() % n;
+        int v = u + 1 < n && rand() % 2 ? u + 1 : (u + 60 < n ? u + 60 : u - 1);
+        if (g.getEdgeWeight(u, v) == std::numeric_limits<int>::max()) continue;
+
+        auto start = Clock::now();
+        updated += edit % 2 ? tree.removeEdge(u, v) : tree.setEdgeWeight(u, v, g.getEdgeWeight(u, v) * 3);
+        repairMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap);
+        recomputeMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    Benchmark benchmark;
+    benchmark.recordCounter("Closure repair, 100 edits (ms)", repairMs);
+    benchmark.recordCounter("Recompute, 100 edits (ms)", recomputeMs);
+    benchmark.recordCounter("Vertices updated (incremental)", static_cast<double>(updated));
+    benchmark.recordCounter("Vertices settled (recompute)", static_cast<double>(n) * edits);
+    benchmark.displayCounters();
+
+    EXPECT_EQ(tree.snapshot().getDistances(),
+              g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap).getDistances());
+    EXPECT_LT(updated, static_cast<long long>(n) * edits);
+}
+
+TEST(DynamicShortestPathTreeBenchmark, RepairVersusRecompute) {
+    Graph g = makeGridNetwork(60, 11);
+    const int n = g.getVertexCount();
+    DynamicShortestPathTree tree(g, 0);
+
+    srand(5);
+    std::vector<Graph::Edge> bypasses;
+    for (int i = 0; i < 50; ++i) {
+        bypasses.push_back({rand() % n, rand() % n, rand() % 30 + 5});
+    }
+
+    using Clock = std::chrono::steady_clock;
+    long long updated = 0;
+    auto start = Clock::now();
+    for (const Graph::Edge& edge : bypasses) {
+        updated += tree.addEdge(edge.from, edge.to, edge.weight);
+    }
+    double repairMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (size_t i = 0; i < bypasses.size(); ++i) {
+        g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap);
+    }
+    double recomputeMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    Benchmark benchmark;
+    benchmark.recordCounter("Repair time, 50 edits (ms)", repairMs);
+    benchmark.recordCounter("Recompute time, 50 edits (ms)", recomputeMs);
+    benchmark.recordCounter("Vertices updated (incremental)", static_cast<double>(updated));
+    benchmark.recordCounter("Vertices settled (recompute)", static_cast<double>(n) * 50);
+    benchmark.displayCounters();
+
+    EXPECT_EQ(tree.snapshot().getDistances(),
+              g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap).getDistances());
+    EXPECT_LT(updated, static_cast<long long>(n) * 50);
+}
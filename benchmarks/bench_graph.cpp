@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include "Graph.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+#include <vector>
+
+TEST(GraphBenchmark, BinaryHeapVersusLinearScan) {
+    const int n = 4000;
+    Graph g(n);
+    srand(11);
+    for (int i = 0; i + 1 < n; ++i) {
+        g.addEdge(i, i + 1, rand() % 20 + 1);
+        g.addEdge(i, rand() % n, rand() % 50 + 1);
+    }
+
+    Benchmark benchmark;
+    int linearDistance = 0, heapDistance = 0;
+    benchmark.compareAlgorithms("Linear scan Dijkstra", [&]() {
+        linearDistance = g.findShortestPath(0, n - 1, ShortestPathEngine::LinearScan).first;
+    }, "Binary heap Dijkstra", [&]() {
+        heapDistance = g.findShortestPath(0, n - 1, ShortestPathEngine::BinaryHeap).first;
+    }, n, 5);
+    EXPECT_EQ(linearDistance, heapDistance);
+}
+
+TEST(GraphBenchmark, EarlyTerminationSettledVertices) {
+    // 60 x 60 grid road network; local queries stay near the source corner
+    const int side = 60;
+    const int n = side * side;
+    Graph g = makeGridNetwork(side, 3);
+
+    Benchmark benchmark;
+    SearchStats local, cross;
+    benchmark.runBenchmark("Local query", [&]() {
+        local = SearchStats();
+        g.findShortestPath(0, side + 1, ShortestPathEngine::BinaryHeap, &local);
+    }, n, 20);
+    benchmark.runBenchmark("Cross-network query", [&]() {
+        cross = SearchStats();
+        g.findShortestPath(0, n - 1, ShortestPathEngine::BinaryHeap, &cross);
+    }, n, 20);
+
+    benchmark.recordCounter("Vertices in network", n);
+    benchmark.recordCounter("Settled (local query)", local.settledVertices);
+    benchmark.recordCounter("Settled (cross-network query)", cross.settledVertices);
+    benchmark.displayResults();
+    benchmark.displayCounters();
+
+    EXPECT_LT(local.settledVertices, n / 20);
+    EXPECT_LE(cross.settledVertices, n);
+    EXPECT_EQ(benchmark.getCounter("Vertices in network"), n);
+}
+
+TEST(GraphBenchmark, LandmarkAStarSettledVertices) {
+    const int side = 60;
+    const int n = side * side;
+    Graph g = makeGridNetwork(side, 41);
+    g.selectLandmarks(8);
+
+    Benchmark benchmark;
+    SearchStats dijkstra, alt;
+    int plainDistance = 0, altDistance = 0;
+    benchmark.compareAlgorithms("Dijkstra cross-network", [&]() {
+        dijkstra = SearchStats();
+        plainDistance = g.findShortestPath(side - 1, n - side, ShortestPathEngine::BinaryHeap, &dijkstra).first;
+    }, "ALT cross-network", [&]() {
+        alt = SearchStats();
+        altDistance = g.findShortestPath(side - 1, n - side, ShortestPathEngine::AStarLandmarks, &alt).first;
+    }, n, 20);
+    benchmark.recordCounter("Settled (Dijkstra)", dijkstra.settledVertices);
+    benchmark.recordCounter("Settled (ALT)", alt.settledVertices);
+    benchmark.displayCounters();
+
+    EXPECT_EQ(plainDistance, altDistance);
+    EXPECT_LT(alt.settledVertices, dijkstra.settledVertices);
+}
+
+TEST(GraphBenchmark, BidirectionalSettledVertices) {
+    const int side = 60;
+    const int n = side * side;
+    Graph g = makeGridNetwork(side, 47);
+
+    // Long-haul query between opposite corners
+    const int source = side - 1, target = n - side;
+    Benchmark benchmark;
+    SearchStats oneWay, twoWay;
+    int oneWayDistance = 0, twoWayDistance = 0;
+    benchmark.compareAlgorithms("Dijkstra long-haul", [&]() {
+        oneWay = SearchStats();
+        oneWayDistance = g.findShortestPath(source, target, ShortestPathEngine::BinaryHeap, &oneWay).first;
+    }, "Bidirectional long-haul", [&]() {
+        twoWay = SearchStats();
+        twoWayDistance = g.findShortestPath(source, target, ShortestPathEngine::Bidirectional, &twoWay).first;
+    }, n, 20);
+    benchmark.recordCounter("Settled (Dijkstra)", oneWay.settledVertices);
+    benchmark.recordCounter("Settled (bidirectional)", twoWay.settledVertices);
+    benchmark.displayCounters();
+
+    EXPECT_EQ(oneWayDistance, twoWayDistance);
+    EXPECT_LT(twoWay.settledVertices, oneWay.settledVertices);
+}
+
+TEST(GraphBenchmark, BulkBuildVersusAddEdge) {
+    const int n = 100000, m = 400000;
+    srand(37);
+    std::vector<Graph::Edge> edges(m);
+    for (Graph::Edge& edge : edges) {
+        edge = {rand() % n, rand() % n, rand() % 100 + 1};
+    }
+
+    Benchmark benchmark;
+    int incrementalEdges = 0, bulkEdges = 0;
+    benchmark.compareAlgorithms("addEdge per road", [&]() {
+        Graph g(n);
+        for (const Graph::Edge& edge : edges) g.addEdge(edge.from, edge.to, edge.weight);
+        incrementalEdges = g.getEdgeCount();
+    }, "Graph::fromEdges", [&]() {
+        bulkEdges = Graph::fromEdges(n, edges).getEdgeCount();
+    }, m, 3);
+
+    EXPECT_EQ(incrementalEdges, bulkEdges);
+}
+
+TEST(GraphBenchmark, ReusedWorkspaceVersusFreshArrays) {
+    const int side = 300;
+    const int n = side * side;
+    Graph g = makeGridNetwork(side, 43);
+
+    // Short local trips, where O(V) initialization dominates the search
+    std::vector<std::pair<int, int>> trips;
+    for (int i = 0; i < 200; ++i) {
+        int v = rand() % (n - side - 1);
+        trips.push_back({v, v + side + 1});
+    }
+
+    Benchmark benchmark;
+    long long freshTotal = 0, reusedTotal = 0;
+    QueryWorkspace workspace;
+    benchmark.compareAlgorithms("Fresh workspace per query", [&]() {
+        for (const auto& trip : trips) {
+            QueryWorkspace fresh;
+            freshTotal += g.findShortestPath(trip.first, trip.second, fresh).first;
+        }
+    }, "Reused workspace", [&]() {
+        for (const auto& trip : trips) {
+            reusedTotal += g.findShortestPath(trip.first, trip.second, workspace).first;
+        }
+    }, trips.size(), 5);
+
+    EXPECT_EQ(freshTotal, reusedTotal);
+}
+
+TEST(GraphBenchmark, DisconnectedQueryRejection) {
+    const int side = 300;
+    const int n = side * side;
+    std::vector<Graph::Edge> edges;
+    srand(47);
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            if (c + 1 < side) edges.push_back({v, v + 1, rand() % 9 + 1});
+            if (r + 1 < side) edges.push_back({v, v + side, rand() % 9 + 1});
+        }
+    }
+    // One island city with no roads to the grid
+    Graph g = Graph::fromEdges(n + 1, edges);
+
+    // Without the index, a query to the island explores the whole grid first
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    ShortestPathTree tree = g.computeShortestPathTree(0);
+    double exhaustiveMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    const int queries = 100000;
+    int rejected = 0;
+    start = Clock::now();
+    for (int q = 0; q < queries; ++q) {
+        rejected += g.findShortestPath(q % n, n).first == std::numeric_limits<int>::max();
+    }
+    double rejectionUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / queries;
+
+    Benchmark benchmark;
+    benchmark.recordCounter("Exhaustive search to the island (ms)", exhaustiveMs);
+    benchmark.recordCounter("Component index rejection (us/query)", rejectionUs);
+    benchmark.displayCounters();
+
+    EXPECT_EQ(tree.distanceTo(n), std::numeric_limits<int>::max());
+    EXPECT_EQ(rejected, queries);
+}
+
+TEST(GraphBenchmark, DistanceOnlyVersusPathQueries) {
+    const int side = 300;
+    Graph g = makeGridNetwork(side, 67);
+
+    std::vector<std::pair<int, int>> trips;
+    // Short neighborhood trips, where path bookkeeping is a visible share of the work
+    for (int i = 0; i < 1000; ++i) {
+        int v = rand() % (side * side - 4 * side - 4);
+        trips.push_back({v, v + 4 * side + 4});
+    }
+
+    Benchmark benchmark;
+    long long pathTotal = 0, distanceTotal = 0;
+    benchmark.compareAlgorithms("findShortestPath", [&]() {
+        for (const auto& trip : trips) pathTotal += g.findShortestPath(trip.first, trip.second).first;
+    }, "findShortestDistance", [&]() {
+        for (const auto& trip : trips) distanceTotal += g.findShortestDistance(trip.first, trip.second);
+    }, trips.size(), 3);
+
+    EXPECT_EQ(pathTotal, distanceTotal);
+}
+
+TEST(GraphBenchmark, BetweennessExactVersusSampled) {
+    const int side = 40;
+    Graph g = makeGridNetwork(side, 97);
+    using Clock = std::chrono::steady_clock;
+
+    Benchmark benchmark;
+    auto start = Clock::now();
+    BetweennessScores single = g.computeBetweenness(1);
+    benchmark.recordCounter("Exact, 1 thread (ms)", std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+
+    start = Clock::now();
+    BetweennessScores parallel = g.computeBetweenness();
+    benchmark.recordCounter("Exact, all threads (ms)",
+                            std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+
+    start = Clock::now();
+    BetweennessScores sampled = g.estimateBetweenness(side * side / 10);
+    benchmark.recordCounter("Sampled, 10% of sources (ms)",
+                            std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    benchmark.displayCounters();
+
+    for (size_t i = 0; i < single.edgeScores.size(); ++i) {
+        ASSERT_NEAR(parallel.edgeScores[i], single.edgeScores[i], 1e-6);
+    }
+    EXPECT_EQ(sampled.sourcesUsed, side * side / 10);
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "HubLabels.h"
+#include "ContractionHierarchy.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+TEST(HubLabelsBenchmark, QueryVersusContractionHierarchyAndDijkstra) {
+    Graph graph = makeGridNetwork(80, 13);
+    const int n = graph.getVertexCount();
+    using Clock = std::chrono::steady_clock;
+
+    Benchmark benchmark;
+    // On a grid every degree ties, so the degree order is shown on a smaller one
+    Graph smallGrid = makeGridNetwork(30, 13);
+    benchmark.recordCounter("30x30 label, degree order", HubLabels(smallGrid, HubOrder::Degree).getAverageLabelSize());
+    benchmark.recordCounter("30x30 label, CH order",
+                            HubLabels(smallGrid, HubOrder::ContractionHierarchy).getAverageLabelSize());
+
+    auto start = Clock::now();
+    HubLabels labels(graph, HubOrder::ContractionHierarchy);
+    benchmark.recordCounter("80x80 build, CH order (ms)",
+                            std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    benchmark.recordCounter("80x80 label, CH order", labels.getAverageLabelSize());
+    ContractionHierarchy ch(graph);
+
+    const int queries = 2000;
+    std::vector<std::pair<int, int>> pairs(queries);
+    srand(29);
+    for (auto& pair : pairs) pair = {rand() % n, rand() % n};
+
+    std::vector<int> expected(queries), actual(queries);
+    start = Clock::now();
+    for (int i = 0; i < queries; i += 20) {
+        expected[i] = graph.findShortestDistance(pairs[i].first, pairs[i].second);
+    }
+    benchmark.recordCounter("Dijkstra query (us)",
+                            std::chrono::duration<double, std::micro>(Clock::now() - start).count() / (queries / 20));
+
+    start = Clock::now();
+    for (int i = 0; i < queries; ++i) actual[i] = ch.findShortestDistance(pairs[i].first, pairs[i].second);
+    benchmark.recordCounter("CH query (us)",
+                            std::chrono::duration<double, std::micro>(Clock::now() - start).count() / queries);
+
+    start = Clock::now();
+    for (int i = 0; i < queries; ++i) actual[i] = labels.findShortestDistance(pairs[i].first, pairs[i].second);
+    benchmark.recordCounter("Hub label query (us)",
+                            std::chrono::duration<double, std::micro>(Clock::now() - start).count() / queries);
+    benchmark.displayCounters();
+
+    for (int i = 0; i < queries; i += 20) EXPECT_EQ(actual[i], expected[i]);
+}
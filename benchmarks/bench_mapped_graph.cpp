@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "MappedGraph.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+TEST(MappedGraphBenchmark, StartupVersusTextParsing) {
+    const int cities = 20000, routes = 80000;
+    const std::string textPath = tempPath("startup.txt");
+    const std::string binaryPath = tempPath("startup.rcg");
+    {
+        std::ofstream text(textPath);
+        srand(17);
+        text << cities << " " << routes << "\n";
+        for (int i = 0; i < routes; ++i) {
+            text << rand() % cities << " " << rand() % cities << " " << rand() % 100 + 1 << "\n";
+        }
+    }
+    MappedGraph::convertText(textPath, binaryPath);
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    {
+        std::ifstream text(textPath);
+        int n, m;
+        text >> n >> m;
+        Graph graph(n);
+        for (int i = 0; i < m; ++i) {
+            int a, b, w;
+            text >> a >> b >> w;
+            graph.addEdge(a, b, w);
+        }
+        EXPECT_GT(graph.getEdgeCount(), 0);
+    }
+    double parseMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    start = Clock::now();
+    MappedGraph mapped(binaryPath);
+    double mapMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    Benchmark benchmark;
+    benchmark.recordCounter("Text parse + addEdge (ms)", parseMs);
+    benchmark.recordCounter("mmap open (ms)", mapMs);
+    benchmark.recordCounter("Edges", mapped.getEdgeCount());
+    benchmark.displayCounters();
+
+    EXPECT_LT(mapMs, parseMs);
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+}
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include "Graph.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+TEST(MonotoneQueueBenchmark, BucketAndRadixVersusBinaryHeap) {
+    const int n = 200000;
+    Graph roads = makeRandomNetwork(n, 3 * n, 100, 71);
+    using Clock = std::chrono::steady_clock;
+
+    Benchmark benchmark;
+    std::vector<int> reference;
+    for (ShortestPathEngine engine : {ShortestPathEngine::BinaryHeap, ShortestPathEngine::BucketQueue,
+                                      ShortestPathEngine::RadixHeap}) {
+        const int runs = 3;
+        std::vector<int> distances;
+        auto start = Clock::now();
+        for (int run = 0; run < runs; ++run) {
+            distances = roads.computeShortestPathTree(run, engine).getDistances();
+        }
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / runs;
+        const char* name = engine == ShortestPathEngine::BinaryHeap ? "Binary heap"
+                           : engine == ShortestPathEngine::BucketQueue ? "Dial's buckets" : "Radix heap";
+        benchmark.recordCounter(std::string(name) + " full tree (ms)", ms);
+
+        if (reference.empty()) reference = distances;
+        EXPECT_EQ(distances, reference);
+    }
+    benchmark.displayCounters();
+}
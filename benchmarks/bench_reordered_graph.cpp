@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+#include "ReorderedGraph.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <chrono>
+
+TEST(ReorderedGraphBenchmark, LocalityAndRuntime) {
+    Graph g = makeShuffledGrid(400, 7);
+    ReorderedGraph rcm(g, VertexOrder::ReverseCuthillMcKee);
+
+    using Clock = std::chrono::steady_clock;
+    const int runs = 3;
+    auto start = Clock::now();
+    for (int i = 0; i < runs; ++i) g.computeShortestPathTree(i);
+    double shuffledMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / runs;
+
+    start = Clock::now();
+    for (int i = 0; i < runs; ++i) rcm.getGraph().computeShortestPathTree(rcm.toInternal(i));
+    double reorderedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / runs;
+
+    Benchmark benchmark;
+    benchmark.recordCounter("Neighbor id gap (survey order)", ReorderedGraph::averageNeighborGap(g));
+    benchmark.recordCounter("Neighbor id gap (RCM)", ReorderedGraph::averageNeighborGap(rcm.getGraph()));
+    benchmark.recordCounter("Full tree, survey order (ms)", shuffledMs);
+    benchmark.recordCounter("Full tree, RCM order (ms)", reorderedMs);
+    benchmark.displayCounters();
+
+    EXPECT_EQ(rcm.computeShortestPathTree(0).getDistances(), g.computeShortestPathTree(0).getDistances());
+}
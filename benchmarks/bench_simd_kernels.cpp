@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include "SimdKernels.h"
+#include "Graph.h"
+#include "Benchmark.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+TEST(SimdKernelsBenchmark, DenseDijkstraByLevel) {
+    LevelGuard guard;
+    const int n = 1200;
+    Graph dense = makeDenseGraph(n, 9);
+    using Clock = std::chrono::steady_clock;
+
+    Benchmark benchmark;
+    std::vector<int> reference;
+    for (SimdKernels::Level level : supportedLevels()) {
+        SimdKernels::setLevel(level);
+        const int runs = 5;
+        std::vector<int> distances;
+        auto start = Clock::now();
+        for (int run = 0; run < runs; ++run) {
+            distances = dense.computeShortestPathTree(run).getDistances();
+        }
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / runs;
+        benchmark.recordCounter(std::string("Dense tree, ") + SimdKernels::instructionSet() + " (ms)", ms);
+
+        if (reference.empty()) reference = distances;
+        EXPECT_EQ(distances, reference);
+    }
+    benchmark.displayCounters();
+}
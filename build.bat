@@ -66,7 +66,7 @@ if not exist "obj" mkdir obj
 if not exist "bin" mkdir bin
 
 REM Source files
-set SOURCES=src\main.cpp src\Graph.cpp src\Queue.cpp src\RoadScheduler.cpp src\BankersAlgorithm.cpp src\Config.cpp src\Logger.cpp
+set SOURCES=src\main.cpp src\Graph.cpp src\ShortestPathTree.cpp src\QueryWorkspace.cpp src\BucketQueue.cpp src\RadixHeap.cpp src\ParallelExecutor.cpp src\SimdKernels.cpp src\ContractionHierarchy.cpp src\DynamicShortestPathTree.cpp src\DeltaStepping.cpp src\MappedGraph.cpp src\CompactGraph.cpp src\ReorderedGraph.cpp src\HubLabels.cpp src\Queue.cpp src\RoadScheduler.cpp src\BankersAlgorithm.cpp src\Config.cpp src\Logger.cpp src\Benchmark.cpp
 
 REM Compile source files
 echo Compiling source files...
@@ -82,6 +82,84 @@ if %ERRORLEVEL% NEQ 0 (
     goto :error
 )
 
+%CXX% %CXXFLAGS% %INCLUDES% -c src\ShortestPathTree.cpp -o obj\ShortestPathTree.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile ShortestPathTree.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\QueryWorkspace.cpp -o obj\QueryWorkspace.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile QueryWorkspace.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\BucketQueue.cpp -o obj\BucketQueue.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile BucketQueue.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\RadixHeap.cpp -o obj\RadixHeap.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile RadixHeap.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\ParallelExecutor.cpp -o obj\ParallelExecutor.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile ParallelExecutor.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\SimdKernels.cpp -o obj\SimdKernels.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile SimdKernels.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\ContractionHierarchy.cpp -o obj\ContractionHierarchy.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile ContractionHierarchy.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\DynamicShortestPathTree.cpp -o obj\DynamicShortestPathTree.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile DynamicShortestPathTree.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\DeltaStepping.cpp -o obj\DeltaStepping.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile DeltaStepping.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\MappedGraph.cpp -o obj\MappedGraph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile MappedGraph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\CompactGraph.cpp -o obj\CompactGraph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile CompactGraph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\ReorderedGraph.cpp -o obj\ReorderedGraph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile ReorderedGraph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c src\HubLabels.cpp -o obj\HubLabels.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile HubLabels.cpp
+    goto :error
+)
+
 %CXX% %CXXFLAGS% %INCLUDES% -c src\Queue.cpp -o obj\Queue.o
 if %ERRORLEVEL% NEQ 0 (
     echo Failed to compile Queue.cpp
@@ -112,9 +190,15 @@ if %ERRORLEVEL% NEQ 0 (
     goto :error
 )
 
+%CXX% %CXXFLAGS% %INCLUDES% -c src\Benchmark.cpp -o obj\Benchmark.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile Benchmark.cpp
+    goto :error
+)
+
 REM Link main executable
 echo Linking main executable...
-%CXX% obj\main.o obj\Graph.o obj\Queue.o obj\RoadScheduler.o obj\BankersAlgorithm.o obj\Config.o obj\Logger.o -o bin\RoadConstruction.exe
+%CXX% obj\main.o obj\Graph.o obj\ShortestPathTree.o obj\QueryWorkspace.o obj\BucketQueue.o obj\RadixHeap.o obj\ParallelExecutor.o obj\SimdKernels.o obj\ContractionHierarchy.o obj\DynamicShortestPathTree.o obj\DeltaStepping.o obj\MappedGraph.o obj\CompactGraph.o obj\ReorderedGraph.o obj\HubLabels.o obj\Queue.o obj\RoadScheduler.o obj\BankersAlgorithm.o obj\Config.o obj\Logger.o obj\Benchmark.o -pthread -o bin\RoadConstruction.exe
 if %ERRORLEVEL% NEQ 0 (
     echo Failed to link main executable
     goto :error
@@ -129,7 +213,7 @@ if %ERRORLEVEL% NEQ 0 (
 )
 
 echo Linking demo executable...
-%CXX% obj\demo.o obj\Graph.o obj\Queue.o obj\RoadScheduler.o obj\BankersAlgorithm.o obj\Config.o obj\Logger.o -o bin\RoadConstructionDemo.exe
+%CXX% obj\demo.o obj\Graph.o obj\ShortestPathTree.o obj\QueryWorkspace.o obj\BucketQueue.o obj\RadixHeap.o obj\ParallelExecutor.o obj\SimdKernels.o obj\ContractionHierarchy.o obj\DynamicShortestPathTree.o obj\DeltaStepping.o obj\MappedGraph.o obj\CompactGraph.o obj\ReorderedGraph.o obj\HubLabels.o obj\Queue.o obj\RoadScheduler.o obj\BankersAlgorithm.o obj\Config.o obj\Logger.o obj\Benchmark.o -pthread -o bin\RoadConstructionDemo.exe
 if %ERRORLEVEL% NEQ 0 (
     echo Failed to link demo executable
     goto :error
@@ -170,6 +254,66 @@ if %ERRORLEVEL% NEQ 0 (
     goto :error
 )
 
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_parallel_executor.cpp -o obj\test_parallel_executor.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_parallel_executor.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_simd_kernels.cpp -o obj\test_simd_kernels.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_simd_kernels.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_monotone_queues.cpp -o obj\test_monotone_queues.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_monotone_queues.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_contraction_hierarchy.cpp -o obj\test_contraction_hierarchy.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_contraction_hierarchy.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_dynamic_shortest_path_tree.cpp -o obj\test_dynamic_shortest_path_tree.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_dynamic_shortest_path_tree.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_delta_stepping.cpp -o obj\test_delta_stepping.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_delta_stepping.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_mapped_graph.cpp -o obj\test_mapped_graph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_mapped_graph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_compact_graph.cpp -o obj\test_compact_graph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_compact_graph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_reordered_graph.cpp -o obj\test_reordered_graph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_reordered_graph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -c tests\test_hub_labels.cpp -o obj\test_hub_labels.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile test_hub_labels.cpp
+    goto :error
+)
+
 REM Temporarily skip problematic test files
 REM %CXX% %CXXFLAGS% %INCLUDES% -c tests\test_new_features.cpp -o obj\test_new_features.o
 REM if %ERRORLEVEL% NEQ 0 (
@@ -185,12 +329,82 @@ if %ERRORLEVEL% NEQ 0 (
 
 REM Link test executable
 echo Linking test executable...
-%CXX% obj\test_main.o obj\test_graph.o obj\test_scheduler.o obj\test_bankers.o obj\Graph.o obj\Queue.o obj\RoadScheduler.o obj\BankersAlgorithm.o obj\Config.o obj\Logger.o %GTEST_LIBS% -o bin\RoadConstructionTests.exe
+%CXX% obj\test_main.o obj\test_graph.o obj\test_scheduler.o obj\test_bankers.o obj\test_parallel_executor.o obj\test_simd_kernels.o obj\test_monotone_queues.o obj\test_contraction_hierarchy.o obj\test_dynamic_shortest_path_tree.o obj\test_delta_stepping.o obj\test_mapped_graph.o obj\test_compact_graph.o obj\test_reordered_graph.o obj\test_hub_labels.o obj\Graph.o obj\ShortestPathTree.o obj\QueryWorkspace.o obj\BucketQueue.o obj\RadixHeap.o obj\ParallelExecutor.o obj\SimdKernels.o obj\ContractionHierarchy.o obj\DynamicShortestPathTree.o obj\DeltaStepping.o obj\MappedGraph.o obj\CompactGraph.o obj\ReorderedGraph.o obj\HubLabels.o obj\Queue.o obj\RoadScheduler.o obj\BankersAlgorithm.o obj\Config.o obj\Logger.o obj\Benchmark.o %GTEST_LIBS% -o bin\RoadConstructionTests.exe
 if %ERRORLEVEL% NEQ 0 (
     echo Failed to link test executable
     goto :error
 )
 
+REM Compile benchmarks; they are built here but run by hand
+echo Compiling benchmark files...
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_graph.cpp -o obj\bench_graph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_graph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_simd_kernels.cpp -o obj\bench_simd_kernels.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_simd_kernels.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_monotone_queues.cpp -o obj\bench_monotone_queues.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_monotone_queues.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_contraction_hierarchy.cpp -o obj\bench_contraction_hierarchy.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_contraction_hierarchy.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_dynamic_shortest_path_tree.cpp -o obj\bench_dynamic_shortest_path_tree.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_dynamic_shortest_path_tree.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_delta_stepping.cpp -o obj\bench_delta_stepping.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_delta_stepping.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_mapped_graph.cpp -o obj\bench_mapped_graph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_mapped_graph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_compact_graph.cpp -o obj\bench_compact_graph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_compact_graph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_reordered_graph.cpp -o obj\bench_reordered_graph.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_reordered_graph.cpp
+    goto :error
+)
+
+%CXX% %CXXFLAGS% %INCLUDES% -Itests -c benchmarks\bench_hub_labels.cpp -o obj\bench_hub_labels.o
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to compile bench_hub_labels.cpp
+    goto :error
+)
+
+REM Link benchmark executable
+echo Linking benchmark executable...
+%CXX% obj\bench_graph.o obj\bench_simd_kernels.o obj\bench_monotone_queues.o obj\bench_contraction_hierarchy.o obj\bench_dynamic_shortest_path_tree.o obj\bench_delta_stepping.o obj\bench_mapped_graph.o obj\bench_compact_graph.o obj\bench_reordered_graph.o obj\bench_hub_labels.o obj\Graph.o obj\ShortestPathTree.o obj\QueryWorkspace.o obj\BucketQueue.o obj\RadixHeap.o obj\ParallelExecutor.o obj\SimdKernels.o obj\ContractionHierarchy.o obj\DynamicShortestPathTree.o obj\DeltaStepping.o obj\MappedGraph.o obj\CompactGraph.o obj\ReorderedGraph.o obj\HubLabels.o obj\Queue.o obj\RoadScheduler.o obj\BankersAlgorithm.o obj\Config.o obj\Logger.o obj\Benchmark.o %GTEST_LIBS% -o bin\RoadConstructionBenchmarks.exe
+if %ERRORLEVEL% NEQ 0 (
+    echo Failed to link benchmark executable
+    goto :error
+)
+
 REM Run tests
 echo.
 echo Running tests...
@@ -216,6 +430,9 @@ echo   - bin\RoadConstructionDemo.exe (demo program)
 if exist "bin\RoadConstructionTests.exe" (
     echo   - bin\RoadConstructionTests.exe (test suite)
 )
+if exist "bin\RoadConstructionBenchmarks.exe" (
+    echo   - bin\RoadConstructionBenchmarks.exe (benchmarks)
+)
 echo.
 pause
 exit /b 0
@@ -25,6 +25,7 @@ private:
     };
 
     std::vector<BenchmarkResult> results;
+    std::vector<std::pair<std::string, double>> counters;
 
     /**
      * @brief Measures execution time of a function
@@ -160,8 +161,28 @@ public:
      */
     void clear() {
         results.clear();
+        counters.clear();
     }
 
+    /**
+     * @brief Records a work counter (e.g. settled vertices) next to the timings
+     * @param name Counter name; recording the same name again overwrites it
+     * @param value Counter value
+     */
+    void recordCounter(const std::string& name, double value);
+
+    /**
+     * @brief Gets a recorded counter
+     * @param name Counter name
+     * @return Counter value, or 0 if it was never recorded
+     */
+    double getCounter(const std::string& name) const;
+
+    /**
+     * @brief Displays recorded counters in a formatted table
+     */
+    void displayCounters() const;
+
     /**
      * @brief Exports results to CSV format
      * @param filename Output filename
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Dial's monotone priority queue of vertices keyed by distance
+ *
+ * With integer edge weights in [0, C], every key waiting in a Dijkstra
+ * queue lies in [d, d + C] where d is the last key popped. C + 1 buckets
+ * used circularly (key modulo C + 1) therefore hold the whole frontier:
+ * push is O(1) and pop advances a cursor over at most C empty buckets.
+ * Keys must never be smaller than the last popped key (0 before the
+ * first pop), nor exceed it by more than C.
+ */
+class BucketQueue {
+private:
+    std::vector<std::vector<int>> buckets;
+    long long cursor;  // last popped key; the next pop scans forward from it
+    size_t count;
+
+public:
+    /**
+     * @brief Creates a queue for edge weights up to maxWeight
+     * @param maxWeight Largest key increase a relaxation can cause
+     */
+    explicit BucketQueue(int maxWeight = 0);
+
+    /**
+     * @brief Empties the queue and resizes it for a new weight bound
+     *
+     * Bucket storage keeps its capacity, so reused queues do not allocate.
+     *
+     * @param maxWeight Largest key increase a relaxation can cause
+     * @throws std::invalid_argument if maxWeight is negative
+     */
+    void reset(int maxWeight);
+
+    /**
+     * @brief Inserts a vertex
+     * @param key Distance, in [last popped key, last popped key + maxWeight]
+     * @param vertex Vertex to insert
+     */
+    void push(int key, int vertex);
+
+    /**
+     * @brief Removes an entry with the smallest key
+     * @return (key, vertex)
+     * @throws std::underflow_error if the queue is empty
+     */
+    std::pair<int, int> pop();
+
+    /**
+     * @brief Checks if the queue is empty
+     * @return true if no entries are waiting
+     */
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief Gets the number of waiting entries
+     * @return Entry count, including stale duplicates
+     */
+    size_t size() const { return count; }
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include "Graph.h"
+
+/**
+ * @brief Contraction Hierarchies index for fast repeated route queries
+ *
+ * Preprocessing contracts vertices one at a time in order of importance
+ * (edge difference plus contracted neighbors, updated lazily) and adds a
+ * shortcut whenever removing a vertex would destroy a shortest path.
+ * Queries then run a bidirectional Dijkstra that only follows arcs
+ * towards more important vertices, which settles a tiny fraction of the
+ * network, and unpack shortcuts to report the full route.
+ *
+ * The index is a snapshot: rebuild it after editing the source Graph.
+ */
+class ContractionHierarchy {
+private:
+    /**
+     * @brief An arc in the hierarchy; middle is the contracted vertex a
+     *        shortcut bypasses, or -1 for an original road
+     */
+    struct Arc {
+        int to;
+        int weight;
+        int middle;
+    };
+
+    int numVertices;
+    int shortcutCount;
+    std::vector<int> rank;
+
+    // Upward CSR graph: arcs from each vertex to higher-ranked neighbors
+    std::vector<int> upOffsets;
+    std::vector<Arc> upArcs;
+
+    /**
+     * @brief Contracts every vertex and fills rank and the upward graph
+     */
+    void build(const Graph& graph, int witnessSettleLimit);
+
+    /**
+     * @brief Finds the upward arc between two adjacent vertices
+     */
+    const Arc* findArc(int a, int b) const;
+
+    /**
+     * @brief Expands the arc a -> b into original vertices, appending to path
+     *
+     * Appends every vertex after a up to and including b.
+     */
+    void unpackArc(int a, int b, std::vector<int>& path) const;
+
+    /**
+     * @brief Bidirectional upward search shared by the public queries
+     * @param path If non-null, receives the unpacked route
+     * @return Shortest distance, or INT_MAX if unreachable
+     */
+    int query(int source, int destination, SearchStats* stats, std::vector<int>* path) const;
+
+    /**
+     * @brief Exhaustive upward Dijkstra from one vertex
+     * @param space Receives (vertex, distance) for every settled vertex
+     */
+    void upwardSearch(int root, std::vector<std::pair<int, int>>& space) const;
+
+    void checkVertex(int vertex) const;
+
+public:
+    /**
+     * @brief Runs CH preprocessing on a graph
+     * @param graph Road network to index
+     * @param witnessSettleLimit Maximum vertices settled per witness search;
+     *        lower values preprocess faster but may add redundant shortcuts
+     */
+    explicit ContractionHierarchy(const Graph& graph, int witnessSettleLimit = 500);
+
+    /**
+     * @brief Finds the shortest path between two vertices
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @param stats Optional counters filled in with the work performed
+     * @return Pair containing shortest distance (INT_MAX if unreachable) and path
+     */
+    std::pair<int, std::vector<int>> findShortestPath(int source, int destination,
+                                                      SearchStats* stats = nullptr) const;
+
+    /**
+     * @brief Finds the shortest distance without unpacking the route
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @return Shortest distance, or INT_MAX if unreachable
+     */
+    int findShortestDistance(int source, int destination) const;
+
+    /**
+     * @brief Computes shortest distances from every source to every target
+     *
+     * Bucket-based many-to-many: an upward search from each target leaves
+     * (target, distance) entries in a bucket at every vertex it settles;
+     * an upward search from each source then scans the buckets of the
+     * vertices it settles, and the best meeting vertex gives each entry.
+     * That is S + T small searches instead of S * T point queries. Target
+     * and source searches each run in parallel, one table row per source.
+     *
+     * @param sources Row vertices (e.g. depots)
+     * @param targets Column vertices (e.g. construction sites)
+     * @param numThreads Worker threads, 0 for the hardware concurrency
+     * @return Row-major S x T table; entry [i * T + j] is the distance from
+     *         sources[i] to targets[j], or INT_MAX if unreachable
+     */
+    std::vector<int> computeDistanceTable(const std::vector<int>& sources, const std::vector<int>& targets,
+                                          unsigned numThreads = 0) const;
+
+    /**
+     * @brief Gets the number of vertices in the hierarchy
+     * @return Number of vertices
+     */
+    int getVertexCount() const { return numVertices; }
+
+    /**
+     * @brief Gets the number of shortcuts added during preprocessing
+     * @return Number of shortcut edges
+     */
+    int getShortcutCount() const { return shortcutCount; }
+
+    /**
+     * @brief Gets the contraction rank of a vertex (0 = contracted first)
+     * @param vertex Vertex to look up
+     * @return Rank in [0, getVertexCount())
+     */
+    int getRank(int vertex) const;
+};
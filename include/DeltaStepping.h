@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include "Graph.h"
+#include "ParallelExecutor.h"
+
+/**
+ * @brief Parallel delta-stepping single-source shortest paths
+ *
+ * Tentative distances are grouped into buckets of width delta. Each
+ * bucket is emptied by repeatedly relaxing its light arcs (weight <=
+ * delta), which may re-insert vertices into the same bucket, then its
+ * heavy arcs once, which can only reach later buckets. All relaxations
+ * of one round run in parallel with an atomic (distance, predecessor)
+ * minimum per vertex, so state-wide networks are not limited by a single
+ * Dijkstra thread.
+ *
+ * Distances equal those of Graph::findShortestPath. Among equally short
+ * routes the predecessor with the smallest id is kept, so results do not
+ * depend on the thread count. The exception is a tie through a zero-weight
+ * road, which keeps whichever predecessor arrived first: predecessors of
+ * equal distance could otherwise point at each other. Like
+ * ContractionHierarchy, the solver copies the graph: rebuild it after
+ * editing the source Graph.
+ */
+class DeltaStepping {
+private:
+    int numVertices;
+    int bucketWidth;
+    int maxWeight;
+    ParallelExecutor executor;
+
+    // CSR arrays with each row's light arcs before its heavy arcs
+    std::vector<int> rowOffsets;
+    std::vector<int> lightEnd;
+    std::vector<int> neighbors;
+    std::vector<int> edgeWeights;
+
+    /**
+     * @brief Runs the bucketed search
+     * @param target Vertex whose distance is enough, or -1 for a full tree
+     */
+    void run(int source, int target, std::vector<int>& distance, std::vector<int>& previous,
+             SearchStats* stats) const;
+
+    void checkVertex(int vertex) const;
+
+public:
+    /**
+     * @brief Copies a graph into the light/heavy split layout
+     * @param graph Road network (non-negative weights)
+     * @param delta Bucket width; 0 picks max weight / average degree
+     * @param threads Worker threads, 0 for hardware concurrency
+     */
+    explicit DeltaStepping(const Graph& graph, int delta = 0, unsigned threads = 0);
+
+    /**
+     * @brief Computes distances and predecessors from a source to every vertex
+     * @param source Root of the tree
+     * @param stats Optional counters filled in with the work performed
+     * @return Shortest path tree rooted at source
+     */
+    ShortestPathTree computeShortestPathTree(int source, SearchStats* stats = nullptr) const;
+
+    /**
+     * @brief Finds the shortest path between two vertices
+     *
+     * Stops once every bucket that could still improve the destination
+     * has been processed.
+     *
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @param stats Optional counters filled in with the work performed
+     * @return Pair containing shortest distance (INT_MAX if unreachable) and path
+     */
+    std::pair<int, std::vector<int>> findShortestPath(int source, int destination,
+                                                      SearchStats* stats = nullptr) const;
+
+    /**
+     * @brief Gets the bucket width in use
+     * @return Delta
+     */
+    int getBucketWidth() const { return bucketWidth; }
+
+    /**
+     * @brief Gets the number of worker threads
+     * @return Thread count
+     */
+    unsigned getThreadCount() const { return executor.getThreadCount(); }
+
+    /**
+     * @brief Gets the number of vertices
+     * @return Number of vertices
+     */
+    int getVertexCount() const { return numVertices; }
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <vector>
+#include "Graph.h"
+
+/**
+ * @brief Single-source shortest path tree kept current as roads change
+ *
+ * When a road (u, v) is added or shortened and improves the distance to
+ * one endpoint, only the vertices whose route now runs through it can
+ * change; the repair is a Dijkstra seeded from that endpoint that stops
+ * expanding wherever the old distance is already as good. "What if this
+ * bypass is built" studies therefore pay for the affected region rather
+ * than a full search per edit.
+ *
+ * Closing or slowing a road can only hurt the vertices whose tree route
+ * uses it: the subtree below the edge. Edits to non-tree roads cost one
+ * lookup. For a tree road, the subtree's distances are discarded, each
+ * vertex is re-seeded from its neighbors outside it, and a Dijkstra over
+ * the subtree settles the new routes, so closure studies also pay only
+ * for the region they cut off.
+ *
+ * The tree keeps a reference to the graph. Edits made through its own
+ * methods are repaired incrementally; if the graph was edited by other
+ * means since the last update (detected through Graph::getVersion), the
+ * next edit or an explicit refresh recomputes the whole tree.
+ */
+class DynamicShortestPathTree {
+private:
+    Graph& graph;
+    int source;
+    std::vector<int> distance;
+    std::vector<int> previous;
+    unsigned long long syncedVersion;
+    int lastUpdatedVertices;
+
+    /**
+     * @brief Propagates an improvement to `to` through the edge from `from`
+     * @return Number of vertices whose distance decreased
+     */
+    int repair(int from, int to, int weight);
+
+    /**
+     * @brief Recomputes the subtree below (from, to) after the edge got heavier or vanished
+     * @return Number of vertices whose distance increased
+     */
+    int repairSubtree(int from, int to);
+
+    void checkVertex(int vertex) const;
+
+public:
+    /**
+     * @brief Computes the initial tree
+     * @param network Graph to track; must outlive this object
+     * @param sourceVertex Root of the tree
+     */
+    DynamicShortestPathTree(Graph& network, int sourceVertex);
+
+    /**
+     * @brief Adds or shortens a road in the graph and repairs the tree
+     * @param from Source vertex
+     * @param to Destination vertex
+     * @param weight Edge weight
+     * @return Number of vertices whose distance decreased
+     */
+    int addEdge(int from, int to, int weight);
+
+    /**
+     * @brief Closes a road in the graph and repairs the tree
+     * @param from First endpoint
+     * @param to Second endpoint
+     * @return Number of vertices whose distance increased (0 if there was no road)
+     */
+    int removeEdge(int from, int to);
+
+    /**
+     * @brief Changes a road's weight in the graph and repairs the tree
+     * @param from First endpoint
+     * @param to Second endpoint
+     * @param weight New weight, heavier or lighter than the current one
+     * @return Number of vertices whose distance changed
+     * @throws std::invalid_argument if there is no road between the vertices
+     */
+    int setEdgeWeight(int from, int to, int weight);
+
+    /**
+     * @brief Recomputes the tree from scratch with a full Dijkstra run
+     */
+    void refresh();
+
+    /**
+     * @brief Checks whether the graph was edited outside this tree
+     * @return true if refresh() (or the next edit) will recompute
+     */
+    bool isStale() const { return syncedVersion != graph.getVersion(); }
+
+    /**
+     * @brief Gets the source vertex of the tree
+     * @return Source vertex
+     */
+    int getSource() const { return source; }
+
+    /**
+     * @brief Gets the shortest distance from the source
+     * @param destination Target vertex
+     * @return Distance, or INT_MAX if unreachable
+     */
+    int distanceTo(int destination) const;
+
+    /**
+     * @brief Gets the predecessor of a vertex on its shortest path
+     * @param vertex Vertex in the tree
+     * @return Previous vertex, or -1 for the source and unreachable vertices
+     */
+    int predecessorOf(int vertex) const;
+
+    /**
+     * @brief Reconstructs the route from the source
+     * @param destination Target vertex
+     * @return Vertices from source to destination, empty if unreachable
+     */
+    std::vector<int> pathTo(int destination) const;
+
+    /**
+     * @brief Copies the current state into an immutable tree
+     * @return Snapshot of distances and predecessors
+     */
+    ShortestPathTree snapshot() const;
+
+    /**
+     * @brief Gets how many vertices the last update changed
+     * @return Updated vertex count of the last edit or refresh
+     */
+    int getLastUpdatedVertices() const { return lastUpdatedVertices; }
+};
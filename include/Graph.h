@@ -4,41 +4,707 @@
 #include <limits>
 #include <queue>
 #include <unordered_map>
+#include <mutex>
+#include <list>
+#include "ShortestPathTree.h"
+#include "QueryWorkspace.h"
+
+/**
+ * @brief Selects how a Graph stores its edges
+ */
+enum class GraphStorage {
+    Dense,  // V x V adjacency matrix, only sensible for tiny graphs
+    Sparse  // Compressed sparse row (CSR) arrays, O(V + E) memory
+};
+
+/**
+ * @brief Selects the priority structure used by Dijkstra's algorithm
+ */
+enum class ShortestPathEngine {
+    Auto,        // LinearScan for dense storage; BucketQueue or RadixHeap by max weight for sparse
+    LinearScan,  // O(V^2) minimum scan, best for small dense graphs
+    BinaryHeap,     // O((V + E) log V) binary heap with lazy deletion
+    AStarLandmarks, // A* guided by landmark (ALT) lower bounds; needs landmarks
+    Bidirectional,  // Alternating forward/backward heap searches meeting in the middle
+    BucketQueue,    // O(V + E + max distance) Dial's circular buckets for small integer weights
+    RadixHeap       // O(E + V log C) monotone radix heap for wider integer weight ranges
+};
+
+/**
+ * @brief Work counters collected by a shortest path search
+ */
+struct SearchStats {
+    int settledVertices = 0;  // Vertices whose distance was finalized
+    int relaxedEdges = 0;     // Edges examined while settling them
+};
+
+/**
+ * @brief Betweenness centrality of every city and road
+ *
+ * Scores count unordered (s, t) pairs: each pair adds the fraction of its
+ * shortest routes that pass through a vertex (as an interior stop) or use
+ * a road. Sampled scores are scaled up to estimate the same quantity.
+ */
+struct BetweennessScores {
+    std::vector<double> vertexScores;        // Indexed by vertex
+    std::vector<std::pair<int, int>> edges;  // Every road once as (u, v) with u < v, sorted
+    std::vector<double> edgeScores;          // edgeScores[i] belongs to edges[i]
+    int sourcesUsed = 0;                     // Single-source searches run
+};
 
 /**
  * @brief Represents a weighted graph for road network analysis
- * 
+ *
  * This class implements Dijkstra's shortest path algorithm to find
  * optimal routes between cities in a road construction network.
+ *
+ * Edges are kept either in a dense adjacency matrix or in compressed
+ * sparse row form (row offsets plus contiguous neighbor/weight arrays).
+ * In sparse mode new roads are buffered and merged into the CSR arrays
+ * the next time the graph is queried, so bulk loading stays O(E log E).
  */
 class Graph {
+public:
+    /**
+     * @brief An undirected weighted edge
+     */
+    struct Edge {
+        int from;
+        int to;
+        int weight;
+    };
+
 private:
+    /**
+     * @brief Mutex wrapper that keeps Graph copyable
+     */
+    struct CopyableMutex {
+        std::mutex mutex;
+        CopyableMutex() = default;
+        CopyableMutex(const CopyableMutex&) {}
+        CopyableMutex& operator=(const CopyableMutex&) { return *this; }
+    };
+
+    GraphStorage storage;
+    ShortestPathEngine defaultEngine;
     std::vector<std::vector<int>> adjacencyMatrix;
     int numVertices;
     static const int INF = std::numeric_limits<int>::max();
 
+    // Largest weight ever added (never lowered); bounds Dial's bucket count
+    int maxEdgeWeight;
+
+    // CSR arrays: the neighbors of v are neighbors[rowOffsets[v] .. rowOffsets[v + 1]),
+    // sorted by vertex id, with the matching edge weights in edgeWeights. Kept as
+    // separate vectors so eraseArc and rebuildCsr can resize them independently
+    mutable std::vector<int> rowOffsets;
+    mutable std::vector<int> neighbors;
+    mutable std::vector<int> edgeWeights;
+    mutable std::vector<Edge> pendingEdges;
+    mutable bool csrDirty;
+    mutable CopyableMutex compactionLock;
+
+    // ALT landmarks: landmarkDistances[v * landmarks.size() + i] is the
+    // distance between vertex v and landmarks[i], recomputed lazily after edits
+    std::vector<int> landmarks;
+    mutable std::vector<int> landmarkDistances;
+    mutable bool landmarksDirty;
+    mutable CopyableMutex landmarkLock;
+
+    // Bumped by every edit so cached routes can be recognized as stale
+    unsigned long long version;
+
+    // Union-find over the roads added so far. Following componentParent
+    // from any vertex ends at its component's root; componentSize is only
+    // meaningful at roots. Union by size keeps the chains O(log V) long.
+    std::vector<int> componentParent;
+    std::vector<int> componentSize;
+    int componentCount;
+
+    /**
+     * @brief Finds the root of a vertex's component
+     *
+     * Does not compress paths, so concurrent const queries stay read-only.
+     */
+    int findComponent(int vertex) const;
+
+    /**
+     * @brief Merges the components of two vertices, halving both paths
+     */
+    void uniteComponents(int a, int b);
+
+    /**
+     * @brief Recomputes the component index from the current edges
+     */
+    void rebuildComponents();
+
+    /**
+     * @brief A cached route, keyed by (min(source, destination), max(...))
+     */
+    struct CachedRoute {
+        long long key;
+        int distance;
+        std::vector<int> path;
+    };
+
+    // Bounded LRU route cache, most recently used entry first
+    size_t cacheCapacity;
+    mutable std::list<CachedRoute> cacheEntries;
+    mutable std::unordered_map<long long, std::list<CachedRoute>::iterator> cacheIndex;
+    mutable unsigned long long cacheVersion;
+    mutable size_t cacheHits;
+    mutable size_t cacheMisses;
+    mutable CopyableMutex cacheLock;
+
+    /**
+     * @brief Looks up a route in the cache
+     * @return true on a hit, with result filled in
+     */
+    bool lookupCachedRoute(int source, int destination, std::pair<int, std::vector<int>>& result) const;
+
+    /**
+     * @brief Stores a route, evicting the least recently used entry if full
+     */
+    void storeCachedRoute(int source, int destination, const std::pair<int, std::vector<int>>& result) const;
+
+    /**
+     * @brief Merges buffered edges into the CSR arrays if any are pending
+     */
+    void ensureCompacted() const;
+
+    /**
+     * @brief Rebuilds the CSR arrays from the current rows and pending edges
+     */
+    void rebuildCsr() const;
+
+    /**
+     * @brief Locates an arc in the CSR arrays
+     * @return Index into neighbors/edgeWeights, or -1 if absent
+     */
+    int findArc(int from, int to) const;
+
+    /**
+     * @brief Erases one arc from the compacted CSR arrays
+     */
+    void eraseArc(int from, int to);
+
+    /**
+     * @brief Calls visit(neighbor, weight) for every edge leaving a vertex
+     *
+     * Assumes the CSR arrays are already compacted.
+     */
+    template<typename Visitor>
+    void visitNeighbors(int vertex, Visitor&& visit) const {
+        if (storage == GraphStorage::Dense) {
+            const std::vector<int>& row = adjacencyMatrix[vertex];
+            for (int v = 0; v < numVertices; ++v) {
+                if (v != vertex && row[v] != INF) {
+                    visit(v, row[v]);
+                }
+            }
+        } else {
+            for (int i = rowOffsets[vertex]; i < rowOffsets[vertex + 1]; ++i) {
+                visit(neighbors[i], edgeWeights[i]);
+            }
+        }
+    }
+
+    void checkVertex(int vertex) const;
+
+    /**
+     * @brief Maps Auto to a concrete engine for this graph's storage
+     */
+    ShortestPathEngine resolveEngine(ShortestPathEngine engine) const;
+
+    /**
+     * @brief Dijkstra with an O(V) minimum scan per settled vertex
+     * @param target Stop once this vertex is settled, or -1 to settle everything
+     * @param previous Predecessor array, or nullptr for a distance-only search
+     */
+    void runLinearScan(int source, int target, std::vector<int>& distance,
+                       int* previous, SearchStats* stats) const;
+
+    /**
+     * @brief Dijkstra with a binary heap and lazy deletion of stale entries
+     * @param target Stop once this vertex is settled, or -1 to settle everything
+     */
+    void runBinaryHeap(int source, int target, std::vector<int>& distance,
+                       std::vector<int>& previous, SearchStats* stats) const;
+
+    /**
+     * @brief Label-setting Dijkstra over any label store
+     *
+     * Labels provides distanceTo(v), update(v, distance, parent) and
+     * heapStorage(); both full arrays and a QueryWorkspace qualify. The
+     * engine chooses the queue: a binary heap kept in heapStorage(), or a
+     * per-thread BucketQueue or RadixHeap.
+     *
+     * @param engine BinaryHeap, BucketQueue or RadixHeap
+     */
+    template<typename Labels>
+    void runHeapSearch(ShortestPathEngine engine, int source, int target, Labels& labels,
+                       SearchStats* stats) const;
+
+    /**
+     * @brief The Dijkstra loop shared by every queue; stale entries are skipped when popped
+     */
+    template<typename PriorityQueue, typename Labels>
+    void runQueueSearch(int source, int target, PriorityQueue& queue, Labels& labels,
+                        SearchStats* stats) const;
+
+    /**
+     * @brief Checks whether a resolved engine runs through runHeapSearch
+     */
+    static bool isLabelSetting(ShortestPathEngine engine);
+
+    /**
+     * @brief Runs the resolved engine recording distances only
+     *
+     * Heap searches write into the workspace without predecessors; other
+     * engines fall back to runSearch and copy their distances over.
+     * Afterwards workspace.distanceTo(target) is exact, or every distance
+     * when target is -1.
+     *
+     * @param target Stop once this vertex is settled, or -1 to settle everything
+     */
+    void runDistanceSearch(ShortestPathEngine engine, int source, int target,
+                           QueryWorkspace& workspace, SearchStats* stats) const;
+
+    /**
+     * @brief A* search using triangle-inequality bounds from the landmarks
+     */
+    void runAStarLandmarks(int source, int target, std::vector<int>& distance,
+                           std::vector<int>& previous, SearchStats* stats) const;
+
+    /**
+     * @brief Bidirectional Dijkstra; on return previous traces the whole
+     *        source-to-target route and distance[target] holds its length
+     */
+    void runBidirectional(int source, int target, std::vector<int>& distance,
+                          std::vector<int>& previous, SearchStats* stats) const;
+
+    /**
+     * @brief Runs Brandes' algorithm from the given sources, scaling every credit
+     */
+    BetweennessScores runBrandes(const std::vector<int>& sources, double scale, unsigned numThreads) const;
+
+    /**
+     * @brief Recomputes landmark distances if the graph changed since the last run
+     */
+    void ensureLandmarkDistances() const;
+
+    /**
+     * @brief Computes the distances from one landmark to every vertex
+     */
+    std::vector<int> distancesFrom(int source) const;
+
+    /**
+     * @brief Runs the resolved engine from source into caller-provided arrays
+     *
+     * distance and previous must be sized to the vertex count and filled
+     * with INF and -1 respectively.
+     */
+    void runSearch(ShortestPathEngine engine, int source, int target, std::vector<int>& distance,
+                   std::vector<int>& previous, SearchStats* stats) const;
+
+    /**
+     * @brief Walks the predecessor chain back from a destination
+     * @return Path from the search source to destination, empty if unreachable
+     */
+    static std::vector<int> buildPath(const std::vector<int>& previous,
+                                      const std::vector<int>& distance, int destination);
+
 public:
+    // Auto picks BucketQueue for sparse graphs whose weights stay within
+    // this bound (Dial's queue keeps maxWeight + 1 buckets), RadixHeap above it
+    static const int BUCKET_QUEUE_WEIGHT_LIMIT = 4096;
+
     /**
      * @brief Constructs a graph with the specified number of vertices
      * @param vertices Number of vertices (cities) in the graph
+     * @param storageMode Edge storage layout (sparse CSR by default)
+     * @param engine Default shortest path engine for findShortestPath
+     */
+    explicit Graph(int vertices, GraphStorage storageMode = GraphStorage::Sparse,
+                   ShortestPathEngine engine = ShortestPathEngine::Auto);
+
+    /**
+     * @brief Builds a graph from a whole edge list at once
+     *
+     * Arcs are bucketed by source vertex into one exactly sized buffer,
+     * each row is sorted, and parallel roads collapse to their minimum
+     * weight in the same pass. This avoids the per-edge bookkeeping of
+     * addEdge when loading large networks. Self loops are dropped.
+     *
+     * The result keeps the usual three CSR vectors rather than one packed
+     * allocation: road closures and the pending-edge merge resize rows in
+     * place, and MappedGraph files use the same three sections. A build
+     * allocates the (neighbor, weight) scratch buffer and the two exactly
+     * sized arc arrays, and never grows any of them.
+     *
+     * @param vertices Number of vertices in the graph
+     * @param edges Undirected roads; endpoints must be in [0, vertices)
+     * @param storageMode Edge storage layout (sparse CSR by default)
+     * @param engine Default shortest path engine for findShortestPath
+     * @return The built graph
      */
-    explicit Graph(int vertices);
+    static Graph fromEdges(int vertices, const std::vector<Edge>& edges,
+                           GraphStorage storageMode = GraphStorage::Sparse,
+                           ShortestPathEngine engine = ShortestPathEngine::Auto);
+
+    /**
+     * @brief Builds a graph from a range of Edge values
+     * @param vertices Number of vertices in the graph
+     * @param first Start of the edge range
+     * @param last End of the edge range
+     * @return The built graph
+     */
+    template<typename EdgeIterator>
+    static Graph fromEdges(int vertices, EdgeIterator first, EdgeIterator last,
+                           GraphStorage storageMode = GraphStorage::Sparse,
+                           ShortestPathEngine engine = ShortestPathEngine::Auto) {
+        return fromEdges(vertices, std::vector<Edge>(first, last), storageMode, engine);
+    }
 
     /**
      * @brief Adds an undirected edge between two vertices
+     *
+     * If the edge already exists, the smaller of the two weights is kept.
+     *
      * @param from Source vertex
      * @param to Destination vertex
      * @param weight Weight of the edge (distance in km)
      */
     void addEdge(int from, int to, int weight);
 
+    /**
+     * @brief Closes a road, removing both directions of the edge
+     *
+     * Union-find cannot split a component, so a successful removal
+     * rebuilds the component index in O(V + E); in sparse mode the CSR
+     * rows are shifted in place at the same cost.
+     *
+     * @param from First endpoint
+     * @param to Second endpoint
+     * @return true if a road was removed, false if there was none
+     */
+    bool removeEdge(int from, int to);
+
+    /**
+     * @brief Changes the weight of an existing road, up or down
+     *
+     * Unlike addEdge, a heavier weight replaces the stored one, e.g. for
+     * a lane closure that slows a road without cutting it.
+     *
+     * @param from First endpoint
+     * @param to Second endpoint
+     * @param weight New weight of the edge
+     * @throws std::invalid_argument if there is no road between the vertices
+     */
+    void setEdgeWeight(int from, int to, int weight);
+
+    /**
+     * @brief Checks whether any route joins two vertices
+     *
+     * Answered from the component index maintained by the edits, without
+     * searching. Shortest path queries use it to return INT_MAX and an
+     * empty path immediately when the endpoints are disconnected.
+     *
+     * @param a First vertex
+     * @param b Second vertex
+     * @return true if a and b are in the same connected component
+     */
+    bool isConnected(int a, int b) const;
+
+    /**
+     * @brief Gets the number of connected components
+     * @return Component count (isolated vertices count as one each)
+     */
+    int getComponentCount() const { return componentCount; }
+
     /**
      * @brief Finds the shortest path from source to destination using Dijkstra's algorithm
      * @param source Starting vertex
      * @param destination Target vertex
      * @return Pair containing shortest distance and path
      */
-    std::pair<int, std::vector<int>> findShortestPath(int source, int destination);
+    std::pair<int, std::vector<int>> findShortestPath(int source, int destination) const;
+
+    /**
+     * @brief Finds the shortest path using an explicitly chosen engine
+     *
+     * The search stops as soon as the destination is settled, so nearby
+     * destinations only explore a small part of the network.
+     *
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @param engine Engine to use for this call only
+     * @param stats Optional counters filled in with the work performed
+     * @return Pair containing shortest distance and path
+     */
+    std::pair<int, std::vector<int>> findShortestPath(int source, int destination,
+                                                      ShortestPathEngine engine,
+                                                      SearchStats* stats = nullptr) const;
+
+    /**
+     * @brief Finds the shortest path with queue-based Dijkstra in a caller-owned workspace
+     *
+     * Only the vertices the search reaches are written, so repeated queries
+     * cost nothing proportional to V. findShortestPath uses a per-thread
+     * workspace automatically for the queue-based engines; pass one
+     * explicitly to control its lifetime. Uses the default engine when it
+     * is BinaryHeap, BucketQueue or RadixHeap, otherwise BinaryHeap.
+     *
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @param workspace Scratch space reused across calls (one per thread)
+     * @param stats Optional counters filled in with the work performed
+     * @return Pair containing shortest distance and path
+     */
+    std::pair<int, std::vector<int>> findShortestPath(int source, int destination,
+                                                      QueryWorkspace& workspace,
+                                                      SearchStats* stats = nullptr) const;
+
+    /**
+     * @brief Finds the shortest distance without reconstructing the route
+     *
+     * Skips predecessor bookkeeping and path building, so the common
+     * "just the km" lookup writes half the labels and allocates nothing.
+     * Does not consult the route cache.
+     *
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @return Shortest distance, or INT_MAX if unreachable
+     */
+    int findShortestDistance(int source, int destination) const;
+
+    /**
+     * @brief Finds the shortest distance using an explicitly chosen engine
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @param engine Engine to use for this call only
+     * @param stats Optional counters filled in with the work performed
+     * @return Shortest distance, or INT_MAX if unreachable
+     */
+    int findShortestDistance(int source, int destination, ShortestPathEngine engine,
+                             SearchStats* stats = nullptr) const;
+
+    /**
+     * @brief Answers a batch of distance-only queries in parallel
+     *
+     * Groups queries by source like findShortestPaths, but returns
+     * distances only and never builds a path.
+     *
+     * @param queries Pairs of (source, destination) vertices
+     * @param numThreads Worker threads, 0 for the hardware concurrency
+     * @return One distance (INT_MAX if unreachable) per query, in query order
+     */
+    std::vector<int> findShortestDistances(const std::vector<std::pair<int, int>>& queries,
+                                           unsigned numThreads = 0) const;
+
+    /**
+     * @brief Computes shortest paths from one source to every vertex
+     *
+     * The returned tree answers distance queries in O(1) and path queries
+     * in O(path length), so many destinations from the same depot share a
+     * single search.
+     *
+     * @param source Root vertex (e.g. a depot city)
+     * @return Shortest path tree rooted at source
+     */
+    ShortestPathTree computeShortestPathTree(int source) const;
+
+    /**
+     * @brief Computes a shortest path tree with an explicitly chosen engine
+     * @param source Root vertex
+     * @param engine Engine to use for this call only
+     * @param stats Optional counters filled in with the work performed
+     * @return Shortest path tree rooted at source
+     */
+    ShortestPathTree computeShortestPathTree(int source, ShortestPathEngine engine,
+                                             SearchStats* stats = nullptr) const;
+
+    /**
+     * @brief Chooses landmarks for ShortestPathEngine::AStarLandmarks
+     *
+     * Uses farthest-point selection: each new landmark is the vertex
+     * farthest from those already chosen (vertices in uncovered components
+     * first), then precomputes the distance from every landmark to every
+     * vertex. More landmarks give tighter bounds at O(count * V) memory.
+     *
+     * @param count Number of landmarks (clamped to the vertex count)
+     */
+    void selectLandmarks(int count);
+
+    /**
+     * @brief Uses an explicit set of landmark vertices
+     *
+     * Distances are computed lazily on the next A* query.
+     *
+     * @param vertices Landmark vertices
+     */
+    void setLandmarks(const std::vector<int>& vertices);
+
+    /**
+     * @brief Gets the configured landmark vertices
+     * @return Landmark vertices (empty if none)
+     */
+    const std::vector<int>& getLandmarks() const { return landmarks; }
+
+    /**
+     * @brief Answers a batch of (source, destination) queries in parallel
+     *
+     * Queries are grouped by source so each distinct source is searched
+     * once, and the groups are spread across worker threads. The graph is
+     * only read while the batch runs.
+     *
+     * @param queries Pairs of (source, destination) vertices
+     * @param numThreads Worker threads, 0 for the hardware concurrency
+     * @return One (distance, path) result per query, in query order
+     */
+    std::vector<std::pair<int, std::vector<int>>> findShortestPaths(
+        const std::vector<std::pair<int, int>>& queries, unsigned numThreads = 0) const;
+
+    /**
+     * @brief Computes shortest distances from every source to every target
+     *
+     * Runs one search per vertex on the smaller side (roads are undirected,
+     * so columns can be searched and transposed), spread across worker
+     * threads, instead of S * T point queries. Roots whose component holds
+     * none of the other side are skipped. For repeated tables on a fixed
+     * network, ContractionHierarchy::computeDistanceTable answers the same
+     * question with the bucket-based many-to-many method.
+     *
+     * @param sources Row vertices (e.g. depots)
+     * @param targets Column vertices (e.g. construction sites)
+     * @param numThreads Worker threads, 0 for the hardware concurrency
+     * @return Row-major S x T table; entry [i * T + j] is the distance from
+     *         sources[i] to targets[j], or INT_MAX if unreachable
+     */
+    std::vector<int> computeDistanceTable(const std::vector<int>& sources, const std::vector<int>& targets,
+                                          unsigned numThreads = 0) const;
+
+    /**
+     * @brief Computes the full all-pairs distance table
+     *
+     * Runs a cache-blocked Floyd-Warshall: each round finalizes the
+     * diagonal tile, then its row and column tiles, then updates every
+     * remaining tile in parallel with SIMD min/add row kernels. Memory
+     * is O(V^2), so this is meant for city graphs of up to a few
+     * thousand vertices where table lookups replace repeated searches.
+     *
+     * @param numThreads Worker threads, 0 for the hardware concurrency
+     * @param blockSize Tile edge length in vertices
+     * @return Row-major V x V matrix; entry [i * V + j] is the distance
+     *         from i to j, or INT_MAX if unreachable
+     */
+    std::vector<int> computeAllPairsDistances(unsigned numThreads = 0, int blockSize = 64) const;
+
+    /**
+     * @brief Computes exact vertex and edge betweenness with Brandes' algorithm
+     *
+     * One Dijkstra per source counts shortest routes, then a reverse sweep
+     * over the settle order credits every vertex and road on them, in
+     * O(V * (V + E) log V) total. Sources are spread across worker threads,
+     * each accumulating into its own score arrays, which are summed once
+     * at the end, so no locks are taken inside the searches.
+     *
+     * @param numThreads Worker threads, 0 for the hardware concurrency
+     * @return Scores for every vertex and road
+     */
+    BetweennessScores computeBetweenness(unsigned numThreads = 0) const;
+
+    /**
+     * @brief Estimates betweenness from a random sample of sources
+     *
+     * Runs the same computation from sourceBudget distinct random sources
+     * and scales the totals by V / sourceBudget, which is an unbiased
+     * estimate of the exact scores. Roads that matter to many routes
+     * stand out well before the sample covers the network.
+     *
+     * @param sourceBudget Number of sources to search; the exact scores if >= V
+     * @param numThreads Worker threads, 0 for the hardware concurrency
+     * @param seed Seed for choosing the sources
+     * @return Estimated scores for every vertex and road
+     * @throws std::invalid_argument if sourceBudget is not positive
+     */
+    BetweennessScores estimateBetweenness(int sourceBudget, unsigned numThreads = 0, unsigned seed = 1) const;
+
+    /**
+     * @brief Sets the engine used by findShortestPath(source, destination)
+     * @param engine Engine to use by default
+     */
+    void setShortestPathEngine(ShortestPathEngine engine) { defaultEngine = engine; }
+
+    /**
+     * @brief Gets the default shortest path engine
+     * @return Configured engine (may be Auto)
+     */
+    ShortestPathEngine getShortestPathEngine() const { return defaultEngine; }
+
+    /**
+     * @brief Gets the weight of the edge between two vertices
+     * @param from First vertex
+     * @param to Second vertex
+     * @return Edge weight, 0 when from == to, or INT_MAX if there is no edge
+     */
+    int getEdgeWeight(int from, int to) const;
+
+    /**
+     * @brief Calls visit(neighbor, weight) for every edge leaving a vertex
+     * @param vertex Vertex whose neighbors are visited
+     * @param visit Callable taking (int neighbor, int weight)
+     */
+    template<typename Visitor>
+    void forEachNeighbor(int vertex, Visitor&& visit) const {
+        checkVertex(vertex);
+        ensureCompacted();
+        visitNeighbors(vertex, visit);
+    }
+
+    /**
+     * @brief Enables a bounded LRU cache of (source, destination) routes
+     *
+     * findShortestPath calls without stats consult the cache first. Roads
+     * are undirected, so a route and its reverse share one entry. Any edit
+     * bumps the graph version and empties the cache on the next lookup.
+     *
+     * @param capacity Maximum number of cached routes; 0 disables the cache
+     */
+    void enableRouteCache(size_t capacity);
+
+    /**
+     * @brief Disables the route cache and frees its entries
+     */
+    void disableRouteCache() { enableRouteCache(0); }
+
+    /**
+     * @brief Gets the number of queries answered from the cache
+     * @return Cache hit count
+     */
+    size_t getCacheHits() const;
+
+    /**
+     * @brief Gets the number of cacheable queries that needed a search
+     * @return Cache miss count
+     */
+    size_t getCacheMisses() const;
+
+    /**
+     * @brief Gets the largest weight passed to addEdge, setEdgeWeight or fromEdges
+     *
+     * An upper bound on the current weights, since lowering or removing a
+     * road never shrinks it. Drives the Auto engine choice.
+     *
+     * @return Maximum edge weight (0 for an edgeless graph)
+     */
+    int getMaxEdgeWeight() const { return maxEdgeWeight; }
+
+    /**
+     * @brief Gets the edit counter, bumped by every change to the edges
+     * @return Graph version
+     */
+    unsigned long long getVersion() const { return version; }
 
     /**
      * @brief Gets the number of vertices in the graph
@@ -46,8 +712,20 @@ public:
      */
     int getVertexCount() const { return numVertices; }
 
+    /**
+     * @brief Gets the number of distinct undirected edges
+     * @return Number of edges
+     */
+    int getEdgeCount() const;
+
+    /**
+     * @brief Gets the storage layout of the graph
+     * @return Dense or Sparse
+     */
+    GraphStorage getStorage() const { return storage; }
+
     /**
      * @brief Prints the adjacency matrix for debugging
      */
     void printMatrix() const;
-}; 
\ No newline at end of file
+};
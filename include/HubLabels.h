@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Graph.h"
+
+/**
+ * @brief Vertex orders for building HubLabels
+ */
+enum class HubOrder {
+    Degree,               // Highest degree first, ties by id; cheap, but weak on uniform-degree grids
+    ContractionHierarchy  // Most important CH vertex first; smaller labels
+};
+
+/**
+ * @brief Hub-label distance oracle built by pruned landmark labeling
+ *
+ * Every vertex v stores a label: (hub, distance) pairs such that for any
+ * two vertices some hub on a shortest path between them appears in both
+ * labels. A query is then a linear merge of two short sorted arrays, a
+ * microsecond even on large road networks.
+ *
+ * Labels are built by one pruned Dijkstra per vertex in importance order:
+ * the search from the k-th hub stops at any vertex whose distance the
+ * labels built so far already answer. Hubs are stored as their position
+ * in that order, so labels come out sorted.
+ *
+ * All labels live in one flat array with per-vertex offsets, each label
+ * ending in a sentinel entry, which makes the index a straight memory
+ * image for save() and load(). Like ContractionHierarchy, it is a
+ * snapshot of the graph it was built from.
+ */
+class HubLabels {
+private:
+    /**
+     * @brief One label entry; hub is the hub's position in the build order
+     */
+    struct LabelEntry {
+        std::int32_t hub;
+        std::int32_t distance;
+    };
+
+    /**
+     * @brief On-disk header, 32 bytes
+     */
+    struct FileHeader {
+        char magic[8];
+        std::uint32_t formatVersion;
+        std::uint32_t byteOrderMark;
+        std::uint32_t vertexCount;
+        std::uint32_t reserved;
+        std::uint64_t entryCount;
+    };
+
+    static const std::uint32_t FORMAT_VERSION = 1;
+    static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    int numVertices;
+    // entries[labelOffsets[v] .. labelOffsets[v + 1]) is the label of v, sentinel included
+    std::vector<std::uint32_t> labelOffsets;
+    std::vector<LabelEntry> entries;
+
+    HubLabels();
+
+    void checkVertex(int vertex) const;
+
+    /**
+     * @brief Runs pruned landmark labeling over the given hub order
+     */
+    void build(const Graph& graph, const std::vector<int>& order);
+
+    static std::vector<int> computeOrder(const Graph& graph, HubOrder order);
+
+public:
+    /**
+     * @brief Builds the labels
+     * @param graph Road network to index
+     * @param order Hub order; a CH order costs a CH build but gives smaller labels
+     * @throws std::overflow_error if the labels outgrow 32-bit offsets
+     */
+    explicit HubLabels(const Graph& graph, HubOrder order = HubOrder::Degree);
+
+    /**
+     * @brief Finds the shortest distance by merging two labels
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @return Shortest distance, or INT_MAX if unreachable
+     */
+    int findShortestDistance(int source, int destination) const;
+
+    /**
+     * @brief Compares the labels with Dijkstra on random vertex pairs
+     * @param graph The graph the labels were built from
+     * @param samples Number of random (source, destination) pairs
+     * @param seed Seed for choosing the pairs
+     * @return Number of pairs where the distances differ (0 if correct)
+     * @throws std::invalid_argument if graph has a different vertex count
+     */
+    int crossCheck(const Graph& graph, int samples, unsigned seed = 1) const;
+
+    /**
+     * @brief Writes the flat label arrays to a binary file
+     * @param path Output file
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief Reads labels written by save()
+     * @param path Input file
+     * @return The loaded index
+     * @throws std::runtime_error if the file is missing or malformed
+     */
+    static HubLabels load(const std::string& path);
+
+    /**
+     * @brief Gets the number of vertices
+     * @return Number of vertices
+     */
+    int getVertexCount() const { return numVertices; }
+
+    /**
+     * @brief Gets the total number of (hub, distance) pairs
+     * @return Label entries, not counting sentinels
+     */
+    std::size_t getEntryCount() const { return entries.size() - numVertices; }
+
+    /**
+     * @brief Gets the average label size
+     * @return Entries per vertex (0 for an empty graph)
+     */
+    double getAverageLabelSize() const {
+        return numVertices == 0 ? 0.0 : static_cast<double>(getEntryCount()) / numVertices;
+    }
+
+    /**
+     * @brief Gets the bytes used by the label arrays
+     * @return Memory footprint of offsets and entries
+     */
+    std::size_t getMemoryBytes() const {
+        return labelOffsets.size() * sizeof(std::uint32_t) + entries.size() * sizeof(LabelEntry);
+    }
+};
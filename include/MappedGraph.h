@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+#include "Graph.h"
+
+/**
+ * @brief Read-only road network backed by a memory-mapped binary file
+ *
+ * The file holds a built graph in CSR form, so opening it is a single
+ * mmap plus one sequential validation pass over the offsets and neighbor
+ * ids: no parsing, no addEdge calls and no copying. Layout (native byte
+ * order):
+ *
+ *   header    magic "RCGRAPH", format version, byte-order mark,
+ *             vertex count, arc count (both directions of every road)
+ *   offsets   int32[vertexCount + 1], row start of each vertex
+ *   neighbors int32[arcCount], sorted within each row
+ *   weights   int32[arcCount]
+ */
+class MappedGraph {
+private:
+    /**
+     * @brief On-disk header, 32 bytes
+     */
+    struct FileHeader {
+        char magic[8];
+        std::uint32_t formatVersion;
+        std::uint32_t byteOrderMark;
+        std::uint32_t vertexCount;
+        std::uint32_t reserved;
+        std::uint64_t arcCount;
+    };
+
+    static const std::uint32_t FORMAT_VERSION = 1;
+    static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    const void* mapping;
+    std::size_t mappingSize;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+
+    int numVertices;
+    int numArcs;
+    const std::int32_t* rowOffsets;
+    const std::int32_t* neighbors;
+    const std::int32_t* edgeWeights;
+
+    void unmap();
+    void checkVertex(int vertex) const;
+
+    /**
+     * @brief Binary-heap Dijkstra over the mapped arrays
+     * @param target Vertex to stop at, or -1 for a full tree
+     */
+    void runDijkstra(int source, int target, std::vector<int>& distance,
+                     std::vector<int>& previous) const;
+
+public:
+    /**
+     * @brief Maps a binary graph file and validates its header and CSR arrays
+     * @param path File written by write() or convertText()
+     * @throws std::runtime_error if the file cannot be mapped or is malformed
+     */
+    explicit MappedGraph(const std::string& path);
+
+    ~MappedGraph();
+
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+
+    /**
+     * @brief Writes a graph in the binary format
+     * @param graph Graph to serialize
+     * @param path Output file
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static void write(const Graph& graph, const std::string& path);
+
+    /**
+     * @brief Converts a text network to the binary format
+     *
+     * The text uses the road block layout of the scheduling input files:
+     * "numCities numRoutes" followed by numRoutes "city1 city2 distance"
+     * lines. Anything after the routes is ignored.
+     *
+     * @param textPath Input text file
+     * @param binaryPath Output binary file
+     * @throws std::runtime_error on unreadable or invalid input
+     */
+    static void convertText(const std::string& textPath, const std::string& binaryPath);
+
+    /**
+     * @brief Finds the shortest path between two vertices
+     * @param source Starting vertex
+     * @param destination Target vertex
+     * @return Pair containing shortest distance (INT_MAX if unreachable) and path
+     */
+    std::pair<int, std::vector<int>> findShortestPath(int source, int destination) const;
+
+    /**
+     * @brief Computes shortest paths from a source to every vertex
+     * @param source Root of the tree
+     * @return Shortest path tree rooted at source
+     */
+    ShortestPathTree computeShortestPathTree(int source) const;
+
+    /**
+     * @brief Gets the weight of the road between two vertices
+     * @return Weight, 0 if from == to, or INT_MAX if there is no road
+     */
+    int getEdgeWeight(int from, int to) const;
+
+    /**
+     * @brief Calls visit(neighbor, weight) for every road leaving a vertex
+     * @param vertex Vertex whose neighbors are visited
+     * @param visit Callable taking (int neighbor, int weight)
+     */
+    template<typename Visitor>
+    void forEachNeighbor(int vertex, Visitor&& visit) const {
+        checkVertex(vertex);
+        for (std::int32_t i = rowOffsets[vertex]; i < rowOffsets[vertex + 1]; ++i) {
+            visit(neighbors[i], edgeWeights[i]);
+        }
+    }
+
+    /**
+     * @brief Gets the number of vertices
+     * @return Number of vertices
+     */
+    int getVertexCount() const { return numVertices; }
+
+    /**
+     * @brief Gets the number of undirected roads
+     * @return Number of edges
+     */
+    int getEdgeCount() const { return numArcs / 2; }
+};
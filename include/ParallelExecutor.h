@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * @brief Runs data-parallel loops for graph algorithms on a fixed number of threads
+ *
+ * Each parallelFor call starts its workers, hands out loop indices
+ * dynamically so uneven work balances out, and joins them before
+ * returning. Work items in this project (one search per source, one
+ * block row, ...) are large enough that thread start-up is negligible.
+ */
+class ParallelExecutor {
+private:
+    unsigned threadCount;
+
+public:
+    /**
+     * @brief Creates an executor
+     * @param threads Number of worker threads, 0 for std::thread::hardware_concurrency()
+     */
+    explicit ParallelExecutor(unsigned threads = 0);
+
+    /**
+     * @brief Gets the number of worker threads
+     * @return Worker count (at least 1)
+     */
+    unsigned getThreadCount() const { return threadCount; }
+
+    /**
+     * @brief Runs body(index, worker) for every index in [0, count) and waits
+     *
+     * The worker argument is in [0, getThreadCount()) and can be used to
+     * index per-thread scratch space. The first exception thrown by body
+     * is rethrown in the calling thread.
+     *
+     * @param count Number of iterations
+     * @param body Callable taking (size_t index, unsigned worker)
+     */
+    void parallelFor(size_t count, const std::function<void(size_t, unsigned)>& body) const;
+
+    /**
+     * @brief Runs body(worker) once on every worker thread concurrently
+     *
+     * Unlike parallelFor, every worker id is guaranteed its own thread, so
+     * the body may synchronize workers with a barrier. The first exception
+     * thrown is rethrown in the calling thread; a body that waits on other
+     * workers must not throw between barriers.
+     *
+     * @param body Callable taking (unsigned worker)
+     */
+    void parallelRegion(const std::function<void(unsigned)>& body) const;
+};
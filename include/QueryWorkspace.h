@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <utility>
+
+/**
+ * @brief Reusable scratch space for point-to-point shortest path queries
+ *
+ * A query only touches the vertices it explores, yet fresh distance and
+ * predecessor arrays cost O(V) to allocate and initialize every time.
+ * The workspace keeps its arrays between queries and stamps each entry
+ * with the epoch of the query that wrote it; starting a new query just
+ * bumps the epoch, so stale entries read as unvisited without being
+ * cleared. Keep one workspace per thread: it is not thread-safe.
+ */
+class QueryWorkspace {
+private:
+    std::vector<int> distance;
+    std::vector<int> previous;
+    std::vector<unsigned> stamp;
+    unsigned epoch;
+    std::vector<std::pair<int, int>> heap;
+
+public:
+    // Distance reported for vertices the current query has not reached
+    static const int UNREACHED = std::numeric_limits<int>::max();
+
+    QueryWorkspace();
+
+    /**
+     * @brief Starts a new query, logically resetting every vertex
+     *
+     * O(1) unless the vertex count changed or the epoch counter wrapped.
+     *
+     * @param vertices Number of vertices in the graph being searched
+     */
+    void reset(int vertices);
+
+    /**
+     * @brief Gets the tentative distance of a vertex in the current query
+     * @param vertex Vertex to look up
+     * @return Distance, or INT_MAX if the query has not reached it
+     */
+    int distanceTo(int vertex) const {
+        return stamp[vertex] == epoch ? distance[vertex] : UNREACHED;
+    }
+
+    /**
+     * @brief Gets the predecessor of a vertex in the current query
+     * @param vertex Vertex to look up
+     * @return Previous vertex, or -1 if none
+     */
+    int predecessorOf(int vertex) const {
+        return stamp[vertex] == epoch ? previous[vertex] : -1;
+    }
+
+    /**
+     * @brief Records a shorter distance for a vertex
+     * @param vertex Vertex being updated
+     * @param newDistance Its new tentative distance
+     * @param parent Vertex it was reached from (-1 for the source)
+     */
+    void update(int vertex, int newDistance, int parent) {
+        stamp[vertex] = epoch;
+        distance[vertex] = newDistance;
+        previous[vertex] = parent;
+    }
+
+    /**
+     * @brief Records a shorter distance without touching the predecessor array
+     *
+     * For distance-only queries: predecessorOf and pathTo are meaningless
+     * for vertices written this way until the next reset().
+     *
+     * @param vertex Vertex being updated
+     * @param newDistance Its new tentative distance
+     */
+    void updateDistance(int vertex, int newDistance) {
+        stamp[vertex] = epoch;
+        distance[vertex] = newDistance;
+    }
+
+    /**
+     * @brief Gets the priority queue buffer, emptied by reset()
+     * @return (distance, vertex) heap storage that keeps its capacity
+     */
+    std::vector<std::pair<int, int>>& heapStorage() { return heap; }
+
+    /**
+     * @brief Reconstructs the route found by the current query
+     * @param destination Target vertex
+     * @return Vertices from the source to destination, empty if unreached
+     */
+    std::vector<int> pathTo(int destination) const;
+
+    /**
+     * @brief Gets the vertex count the workspace is sized for
+     * @return Number of vertices
+     */
+    int getVertexCount() const { return static_cast<int>(distance.size()); }
+};
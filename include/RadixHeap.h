@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Monotone radix heap of vertices keyed by distance
+ *
+ * Entry keys are compared with the last popped key: bucket i holds the
+ * keys whose highest bit differing from it is bit i - 1 (bucket 0 holds
+ * keys equal to it). Popping from an empty bucket 0 takes the smallest
+ * key of the first non-empty bucket as the new reference and
+ * redistributes that bucket into lower ones, so each entry moves at most
+ * 32 times regardless of the weight range. This suits integer weights too
+ * wide for BucketQueue. Keys must never be smaller than the last popped key.
+ */
+class RadixHeap {
+private:
+    static const int BUCKETS = 33;
+
+    std::vector<std::pair<unsigned, int>> buckets[BUCKETS];
+    unsigned last;
+    size_t count;
+
+    static int bucketOf(unsigned key, unsigned reference);
+
+public:
+    RadixHeap();
+
+    /**
+     * @brief Empties the heap, keeping bucket capacity for reuse
+     */
+    void reset();
+
+    /**
+     * @brief Inserts a vertex
+     * @param key Non-negative distance, at least the last popped key
+     * @param vertex Vertex to insert
+     */
+    void push(int key, int vertex);
+
+    /**
+     * @brief Removes an entry with the smallest key
+     * @return (key, vertex)
+     * @throws std::underflow_error if the heap is empty
+     */
+    std::pair<int, int> pop();
+
+    /**
+     * @brief Checks if the heap is empty
+     * @return true if no entries are waiting
+     */
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief Gets the number of waiting entries
+     * @return Entry count, including stale duplicates
+     */
+    size_t size() const { return count; }
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include "Graph.h"
+
+/**
+ * @brief Vertex numbering strategies for ReorderedGraph
+ */
+enum class VertexOrder {
+    BreadthFirst,       // BFS discovery order from the lowest id of each component
+    ReverseCuthillMcKee // BFS from a peripheral vertex, neighbors by degree, reversed
+};
+
+/**
+ * @brief A copy of a Graph renumbered so that neighbors sit close in memory
+ *
+ * Input files number cities in survey order, so the CSR rows and the
+ * distance arrays a search touches are scattered across memory. Breadth
+ * first orders (and Reverse Cuthill-McKee in particular) give adjacent
+ * vertices nearby ids, which keeps a Dijkstra frontier within a few cache
+ * lines. Queries take and return original ids; the mapping is applied at
+ * the boundary only.
+ *
+ * Like ContractionHierarchy, this is a snapshot of the source graph.
+ */
+class ReorderedGraph {
+private:
+    Graph graph;
+    std::vector<int> originalToInternal;
+    std::vector<int> internalToOriginal;
+
+    void checkVertex(int vertex) const;
+
+    static std::vector<int> computeOrder(const Graph& source, VertexOrder order);
+
+public:
+    /**
+     * @brief Computes an ordering and builds the renumbered graph
+     * @param source Graph in original numbering
+     * @param order Numbering strategy
+     */
+    explicit ReorderedGraph(const Graph& source, VertexOrder order = VertexOrder::ReverseCuthillMcKee);
+
+    /**
+     * @brief Finds the shortest path between two vertices
+     * @param source Starting vertex (original id)
+     * @param destination Target vertex (original id)
+     * @param engine Engine to run on the renumbered graph
+     * @return Pair containing shortest distance and path in original ids
+     */
+    std::pair<int, std::vector<int>> findShortestPath(int source, int destination,
+                                                      ShortestPathEngine engine = ShortestPathEngine::Auto) const;
+
+    /**
+     * @brief Computes shortest paths from a source to every vertex
+     * @param source Root of the tree (original id)
+     * @return Tree indexed by original ids
+     */
+    ShortestPathTree computeShortestPathTree(int source) const;
+
+    /**
+     * @brief Maps an original vertex id to its renumbered id
+     */
+    int toInternal(int original) const;
+
+    /**
+     * @brief Maps a renumbered vertex id back to its original id
+     */
+    int toOriginal(int internal) const;
+
+    /**
+     * @brief Gets the renumbered graph, e.g. to build a ContractionHierarchy on it
+     * @return Graph in internal numbering
+     */
+    const Graph& getGraph() const { return graph; }
+
+    /**
+     * @brief Measures how far apart adjacent vertices are numbered
+     *
+     * A proxy for cache misses during a search: a small gap means the
+     * neighbors of a vertex share cache lines in the per-vertex arrays.
+     *
+     * @param graph Graph to measure
+     * @return Average |u - v| over all arcs (0 for an edgeless graph)
+     */
+    static double averageNeighborGap(const Graph& graph);
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Overflow policy shared by the shortest path searches
+ *
+ * A road whose route would not fit the distance type is skipped and its
+ * far end remembered. Once the search runs out of vertices, a remembered
+ * vertex that is still unreached really is too far to represent, and the
+ * search throws instead of reporting it as unreachable. Searches that stop
+ * at their target never need the check.
+ */
+
+/**
+ * @brief Extends a settled distance by one road
+ * @param candidate Receives distance + weight when it fits
+ * @return false if the route would reach the distance type's maximum, which
+ *         the searches reserve for "unreachable"; the caller then skips the
+ *         road and remembers its far end
+ */
+template<typename Distance>
+inline bool extendRoute(Distance distance, Distance weight, Distance& candidate) {
+    if (weight >= std::numeric_limits<Distance>::max() - distance) return false;
+    candidate = distance + weight;
+    return true;
+}
+
+/**
+ * @brief Throws if a road skipped by extendRoute left its far end unreached
+ * @param skipped Far ends of the skipped roads
+ * @param distanceOf Gets a vertex's final distance, the type's maximum if unreached
+ */
+template<typename VertexId, typename DistanceOf>
+void checkRouteLengths(const std::vector<VertexId>& skipped, DistanceOf distanceOf) {
+    for (VertexId v : skipped) {
+        using Distance = std::decay_t<decltype(distanceOf(v))>;
+        if (distanceOf(v) == std::numeric_limits<Distance>::max()) {
+            throw std::overflow_error("Route length overflows the distance type");
+        }
+    }
+}
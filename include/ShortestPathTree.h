@@ -0,0 +1,81 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * @brief Shortest path distances and predecessors from a single source
+ *
+ * Produced by Graph::computeShortestPathTree. One tree answers the
+ * distance to any destination in O(1) and the route in O(path length),
+ * so planners asking for every project site from one depot pay for a
+ * single Dijkstra run.
+ */
+class ShortestPathTree {
+private:
+    int source;
+    std::vector<int> distance;
+    std::vector<int> previous;
+
+    void checkVertex(int vertex) const;
+
+public:
+    /**
+     * @brief Wraps the result of a single-source search
+     * @param sourceVertex Root of the tree
+     * @param distances Distance to every vertex (INT_MAX if unreachable)
+     * @param predecessors Previous vertex on each shortest path (-1 for none)
+     */
+    ShortestPathTree(int sourceVertex, std::vector<int> distances, std::vector<int> predecessors);
+
+    /**
+     * @brief Gets the source vertex of the tree
+     * @return Source vertex
+     */
+    int getSource() const { return source; }
+
+    /**
+     * @brief Gets the number of vertices covered by the tree
+     * @return Number of vertices
+     */
+    int getVertexCount() const { return static_cast<int>(distance.size()); }
+
+    /**
+     * @brief Gets the shortest distance from the source
+     * @param destination Target vertex
+     * @return Distance, or INT_MAX if unreachable
+     */
+    int distanceTo(int destination) const;
+
+    /**
+     * @brief Checks whether a vertex is reachable from the source
+     * @param destination Target vertex
+     * @return true if a path exists
+     */
+    bool hasPathTo(int destination) const;
+
+    /**
+     * @brief Gets the predecessor of a vertex on its shortest path
+     * @param vertex Vertex in the tree
+     * @return Previous vertex, or -1 for the source and unreachable vertices
+     */
+    int predecessorOf(int vertex) const;
+
+    /**
+     * @brief Reconstructs the shortest path from the source
+     * @param destination Target vertex
+     * @return Vertices from source to destination, empty if unreachable
+     */
+    std::vector<int> pathTo(int destination) const;
+
+    /**
+     * @brief Gets all distances indexed by vertex
+     * @return Distance vector
+     */
+    const std::vector<int>& getDistances() const { return distance; }
+
+    /**
+     * @brief Gets all predecessors indexed by vertex
+     * @return Predecessor vector
+     */
+    const std::vector<int>& getPredecessors() const { return previous; }
+};
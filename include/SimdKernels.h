@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Vectorized integer kernels shared by the dense graph algorithms
+ *
+ * The kernels work on contiguous int arrays. Each is compiled as a scalar
+ * loop, an SSE2/SSE4.1 loop on x86-64, and an AVX2 loop where the compiler
+ * can target it. The widest variant the running CPU supports is chosen on
+ * first use. Results are identical across implementations.
+ */
+class SimdKernels {
+public:
+    /**
+     * @brief Kernel implementations, narrowest first
+     */
+    enum class Level {
+        Scalar,
+        SSE,   // SSE4.1 when enabled at build time, otherwise SSE2
+        AVX2
+    };
+
+    /**
+     * @brief dst[j] = min(dst[j], offset + src[j]) for j in [0, count)
+     *
+     * Callers must keep offset + src[j] within int range, e.g. by using
+     * INT_MAX / 2 as the "unreachable" sentinel.
+     */
+    static void minPlusRow(int* dst, const int* src, int offset, size_t count);
+
+    /**
+     * @brief Finds the open vertex with the smallest finite distance
+     *
+     * Branch-free min-reduction over distance[j] for lanes where open[j]
+     * is -1 (open) rather than 0 (settled). Ties go to the lowest index.
+     *
+     * @return Index of the minimum, or -1 if every open distance is INT_MAX
+     */
+    static int argMinOpen(const int* distance, const int* open, size_t count);
+
+    /**
+     * @brief Relaxes one adjacency matrix row in a dense Dijkstra
+     *
+     * For every open j with row[j] != INT_MAX and base + row[j] <
+     * distance[j], sets distance[j] = base + row[j] and previous[j] = parent.
+     * previous may be null for distance-only searches, which then skip the
+     * predecessor loads and stores.
+     *
+     * @return Number of entries in row that are not INT_MAX
+     */
+    static size_t relaxRow(int* distance, int* previous, const int* open, const int* row,
+                           int base, int parent, size_t count);
+
+    /**
+     * @brief Gets the widest level supported by this build and CPU
+     */
+    static Level bestSupportedLevel();
+
+    /**
+     * @brief Forces a kernel level, e.g. to compare implementations
+     *
+     * Not synchronized with concurrent kernel calls.
+     *
+     * @throws std::invalid_argument if the level is not supported here
+     */
+    static void setLevel(Level level);
+
+    /**
+     * @brief Gets the level currently in use
+     */
+    static Level getLevel();
+
+    /**
+     * @brief Gets the name of the instruction set in use
+     * @return "AVX2", "SSE4.1", "SSE2" or "scalar"
+     */
+    static const char* instructionSet();
+};
@@ -68,6 +68,35 @@ double Benchmark::getStandardDeviation() const {
     return std::sqrt(sumSquaredDiff / (measurements.size() - 1));
 }
 
+void Benchmark::recordCounter(const std::string& name, double value) {
+    for (auto& counter : counters) {
+        if (counter.first == name) {
+            counter.second = value;
+            return;
+        }
+    }
+    counters.emplace_back(name, value);
+}
+
+double Benchmark::getCounter(const std::string& name) const {
+    for (const auto& counter : counters) {
+        if (counter.first == name) return counter.second;
+    }
+    return 0.0;
+}
+
+void Benchmark::displayCounters() const {
+    std::cout << "\n" << std::string(60, '=') << "\n";
+    std::cout << "                    BENCHMARK COUNTERS\n";
+    std::cout << std::string(60, '=') << "\n";
+    for (const auto& counter : counters) {
+        std::cout << std::left << std::setw(45) << counter.first
+                  << std::right << std::setw(15) << std::fixed << std::setprecision(2)
+                  << counter.second << "\n";
+    }
+    std::cout << std::string(60, '=') << "\n";
+}
+
 void Benchmark::exportToCSV(const std::string& filename) const {
     std::ofstream file(filename);
     if (!file.is_open()) return;
@@ -0,0 +1,41 @@
+#include "BucketQueue.h"
+#include <stdexcept>
+
+BucketQueue::BucketQueue(int maxWeight) : cursor(0), count(0) {
+    reset(maxWeight);
+}
+
+void BucketQueue::reset(int maxWeight) {
+    if (maxWeight < 0) {
+        throw std::invalid_argument("Bucket queue needs non-negative weights");
+    }
+    // A finished search leaves every bucket empty; only an early exit needs the sweep
+    if (count > 0) {
+        for (std::vector<int>& bucket : buckets) {
+            bucket.clear();
+        }
+    }
+    buckets.resize(static_cast<size_t>(maxWeight) + 1);
+    cursor = 0;
+    count = 0;
+}
+
+void BucketQueue::push(int key, int vertex) {
+    buckets[static_cast<size_t>(key) % buckets.size()].push_back(vertex);
+    ++count;
+}
+
+std::pair<int, int> BucketQueue::pop() {
+    if (count == 0) {
+        throw std::underflow_error("Bucket queue is empty");
+    }
+    size_t slot = static_cast<size_t>(cursor % static_cast<long long>(buckets.size()));
+    while (buckets[slot].empty()) {
+        ++cursor;
+        if (++slot == buckets.size()) slot = 0;
+    }
+    int vertex = buckets[slot].back();
+    buckets[slot].pop_back();
+    --count;
+    return {static_cast<int>(cursor), vertex};
+}
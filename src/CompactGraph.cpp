@@ -0,0 +1,197 @@
+#include "CompactGraph.h"
+#include "RouteLength.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+
+// Avoids "comparison is always false" warnings for unsigned types
+template<typename T>
+bool isNegative(T value) {
+    if constexpr (std::is_signed<T>::value) {
+        return value < 0;
+    } else {
+        (void)value;
+        return false;
+    }
+}
+
+}  // namespace
+
+template<typename Weight, typename VertexId, typename Distance>
+CompactGraph<Weight, VertexId, Distance>::CompactGraph(VertexId vertices,
+                                                       const std::vector<Edge>& edges)
+    : numVertices(vertices) {
+    if (isNegative(vertices)) {
+        throw std::invalid_argument("Vertex count must be non-negative");
+    }
+    const std::size_t count = static_cast<std::size_t>(vertices);
+
+    // Same counting-sort layout as Graph::fromEdges
+    rowOffsets.assign(count + 1, 0);
+    for (const Edge& edge : edges) {
+        if (isNegative(edge.from) || edge.from >= vertices || isNegative(edge.to) || edge.to >= vertices) {
+            throw std::out_of_range("Invalid vertex index");
+        }
+        if (isNegative(edge.weight)) {
+            throw std::invalid_argument("Edge weights must be non-negative");
+        }
+        if (edge.from == edge.to) continue;
+        ++rowOffsets[edge.from + 1];
+        ++rowOffsets[edge.to + 1];
+    }
+    for (std::size_t u = 0; u < count; ++u) {
+        rowOffsets[u + 1] += rowOffsets[u];
+    }
+
+    std::vector<std::pair<VertexId, Weight>> arcs(rowOffsets[count]);
+    for (const Edge& edge : edges) {
+        if (edge.from == edge.to) continue;
+        arcs[rowOffsets[edge.from]++] = {edge.to, edge.weight};
+        arcs[rowOffsets[edge.to]++] = {edge.from, edge.weight};
+    }
+    for (std::size_t u = count; u > 0; --u) {
+        rowOffsets[u] = rowOffsets[u - 1];
+    }
+    rowOffsets[0] = 0;
+
+    std::uint32_t write = 0;
+    std::uint32_t begin = 0;
+    for (std::size_t u = 0; u < count; ++u) {
+        std::uint32_t end = rowOffsets[u + 1];
+        std::sort(arcs.begin() + begin, arcs.begin() + end);
+        for (std::uint32_t i = begin; i < end; ++i) {
+            if (i > begin && arcs[i].first == arcs[write - 1].first) continue;
+            arcs[write++] = arcs[i];
+        }
+        rowOffsets[u + 1] = write;
+        begin = end;
+    }
+
+    neighbors.resize(write);
+    edgeWeights.resize(write);
+    for (std::uint32_t i = 0; i < write; ++i) {
+        neighbors[i] = arcs[i].first;
+        edgeWeights[i] = arcs[i].second;
+    }
+}
+
+template<typename Weight, typename VertexId, typename Distance>
+CompactGraph<Weight, VertexId, Distance>
+CompactGraph<Weight, VertexId, Distance>::fromGraph(const Graph& graph) {
+    const int vertices = graph.getVertexCount();
+    if (static_cast<unsigned long long>(vertices)
+        > static_cast<unsigned long long>(std::numeric_limits<VertexId>::max())) {
+        throw std::out_of_range("Vertex count does not fit the vertex id type");
+    }
+
+    std::vector<Edge> edges;
+    edges.reserve(graph.getEdgeCount());
+    for (int u = 0; u < vertices; ++u) {
+        graph.forEachNeighbor(u, [&](int v, int weight) {
+            if (v < u) return;
+            if (weight < 0 || static_cast<unsigned long long>(weight)
+                              > static_cast<unsigned long long>(std::numeric_limits<Weight>::max())) {
+                throw std::out_of_range("Edge weight does not fit the weight type");
+            }
+            edges.push_back({static_cast<VertexId>(u), static_cast<VertexId>(v),
+                             static_cast<Weight>(weight)});
+        });
+    }
+    return CompactGraph(static_cast<VertexId>(vertices), edges);
+}
+
+template<typename Weight, typename VertexId, typename Distance>
+void CompactGraph<Weight, VertexId, Distance>::checkVertex(VertexId vertex) const {
+    if (isNegative(vertex) || vertex >= numVertices) {
+        throw std::out_of_range("Invalid vertex index");
+    }
+}
+
+template<typename Weight, typename VertexId, typename Distance>
+void CompactGraph<Weight, VertexId, Distance>::run(VertexId source, VertexId target,
+                                                   std::vector<Distance>& distance,
+                                                   std::vector<VertexId>& previous,
+                                                   SearchStats* stats) const {
+    using HeapEntry = std::pair<Distance, VertexId>;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+
+    std::vector<VertexId> skipped;  // far ends of roads that would overflow the distance type
+
+    distance[source] = 0;
+    heap.push({0, source});
+
+    while (!heap.empty()) {
+        auto [dist, u] = heap.top();
+        heap.pop();
+        if (dist > distance[u]) continue;
+        if (stats) ++stats->settledVertices;
+        if (u == target) return;
+
+        for (std::uint32_t i = rowOffsets[u]; i < rowOffsets[u + 1]; ++i) {
+            if (stats) ++stats->relaxedEdges;
+            VertexId v = neighbors[i];
+            Distance candidate;
+            if (!extendRoute(dist, static_cast<Distance>(edgeWeights[i]), candidate)) {
+                skipped.push_back(v);
+                continue;
+            }
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                previous[v] = u;
+                heap.push({candidate, v});
+            }
+        }
+    }
+    checkRouteLengths(skipped, [&](VertexId v) { return distance[v]; });
+}
+
+template<typename Weight, typename VertexId, typename Distance>
+std::pair<Distance, std::vector<VertexId>>
+CompactGraph<Weight, VertexId, Distance>::findShortestPath(VertexId source, VertexId destination,
+                                                           SearchStats* stats) const {
+    checkVertex(source);
+    checkVertex(destination);
+    std::vector<Distance> distance(numVertices, UNREACHABLE);
+    std::vector<VertexId> previous(numVertices, numVertices);
+    run(source, destination, distance, previous, stats);
+
+    // numVertices marks "no predecessor", since VertexId may be unsigned
+    std::vector<VertexId> path;
+    if (distance[destination] != UNREACHABLE) {
+        for (VertexId current = destination; current != numVertices; current = previous[current]) {
+            path.push_back(current);
+        }
+        std::reverse(path.begin(), path.end());
+    }
+    return {distance[destination], path};
+}
+
+template<typename Weight, typename VertexId, typename Distance>
+std::vector<Distance> CompactGraph<Weight, VertexId, Distance>::distancesFrom(VertexId source) const {
+    checkVertex(source);
+    std::vector<Distance> distance(numVertices, UNREACHABLE);
+    std::vector<VertexId> previous(numVertices, numVertices);
+    run(source, numVertices, distance, previous, nullptr);
+    return distance;
+}
+
+template<typename Weight, typename VertexId, typename Distance>
+Distance CompactGraph<Weight, VertexId, Distance>::getEdgeWeight(VertexId from, VertexId to) const {
+    checkVertex(from);
+    checkVertex(to);
+    if (from == to) return 0;
+    auto first = neighbors.begin() + rowOffsets[from];
+    auto last = neighbors.begin() + rowOffsets[from + 1];
+    auto it = std::lower_bound(first, last, to);
+    if (it == last || *it != to) return UNREACHABLE;
+    return static_cast<Distance>(edgeWeights[it - neighbors.begin()]);
+}
+
+template class CompactGraph<std::uint16_t, std::uint32_t, std::uint32_t>;
+template class CompactGraph<std::uint16_t, std::uint32_t, std::uint64_t>;
+template class CompactGraph<std::uint32_t, std::uint32_t, std::uint64_t>;
+template class CompactGraph<int, int, int>;
+template class CompactGraph<int, int, long long>;
@@ -0,0 +1,403 @@
+#include "ContractionHierarchy.h"
+#include "ParallelExecutor.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+
+using HeapEntry = std::pair<int, int>;
+using MinHeap = std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>>;
+
+/**
+ * @brief Per-thread query arrays, reset through the list of touched vertices
+ */
+struct QueryScratch {
+    std::vector<int> distance[2];
+    std::vector<int> parent[2];
+    std::vector<int> touched;
+
+    void prepare(int vertices) {
+        if (static_cast<int>(distance[0].size()) != vertices) {
+            for (int side = 0; side < 2; ++side) {
+                distance[side].assign(vertices, INF);
+                parent[side].assign(vertices, -1);
+            }
+            touched.clear();
+        }
+    }
+
+    void reset() {
+        for (int v : touched) {
+            distance[0][v] = distance[1][v] = INF;
+            parent[0][v] = parent[1][v] = -1;
+        }
+        touched.clear();
+    }
+};
+
+thread_local QueryScratch queryScratch;
+
+}  // namespace
+
+ContractionHierarchy::ContractionHierarchy(const Graph& graph, int witnessSettleLimit)
+    : numVertices(graph.getVertexCount()), shortcutCount(0) {
+    if (witnessSettleLimit <= 0) {
+        throw std::invalid_argument("Witness settle limit must be positive");
+    }
+    build(graph, witnessSettleLimit);
+}
+
+void ContractionHierarchy::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= numVertices) {
+        throw std::out_of_range("Invalid vertex index");
+    }
+}
+
+void ContractionHierarchy::build(const Graph& graph, int witnessSettleLimit) {
+    // Remaining (uncontracted) graph; arcs to contracted vertices are erased
+    std::vector<std::vector<Arc>> adjacency(numVertices);
+    for (int u = 0; u < numVertices; ++u) {
+        graph.forEachNeighbor(u, [&](int v, int weight) {
+            adjacency[u].push_back({v, weight, -1});
+        });
+    }
+
+    std::vector<int> contractedNeighbors(numVertices, 0);
+    std::vector<std::vector<Arc>> upward(numVertices);
+    rank.assign(numVertices, -1);
+
+    std::vector<int> witnessDistance(numVertices, INF);
+    std::vector<int> witnessTouched;
+
+    // Bounded Dijkstra from `from` in the remaining graph, avoiding `skip`
+    auto witnessSearch = [&](int from, int skip, int maxDistance) {
+        MinHeap heap;
+        witnessDistance[from] = 0;
+        witnessTouched.push_back(from);
+        heap.push({0, from});
+        int settled = 0;
+        while (!heap.empty()) {
+            auto [dist, x] = heap.top();
+            heap.pop();
+            if (dist > witnessDistance[x]) continue;
+            if (dist > maxDistance || ++settled > witnessSettleLimit) break;
+            for (const Arc& arc : adjacency[x]) {
+                if (arc.to == skip) continue;
+                int candidate = dist + arc.weight;
+                if (candidate < witnessDistance[arc.to]) {
+                    if (witnessDistance[arc.to] == INF) witnessTouched.push_back(arc.to);
+                    witnessDistance[arc.to] = candidate;
+                    heap.push({candidate, arc.to});
+                }
+            }
+        }
+    };
+
+    auto resetWitness = [&]() {
+        for (int v : witnessTouched) witnessDistance[v] = INF;
+        witnessTouched.clear();
+    };
+
+    // Shortcuts (u, w, length) needed to preserve distances if v is removed
+    struct Shortcut {
+        int from;
+        int to;
+        int weight;
+    };
+    auto findShortcuts = [&](int v, std::vector<Shortcut>& shortcuts) {
+        shortcuts.clear();
+        const std::vector<Arc>& arcs = adjacency[v];
+        int longest = 0;
+        for (const Arc& arc : arcs) longest = std::max(longest, arc.weight);
+
+        for (size_t i = 0; i < arcs.size(); ++i) {
+            if (i + 1 == arcs.size()) break;
+            witnessSearch(arcs[i].to, v, arcs[i].weight + longest);
+            for (size_t j = i + 1; j < arcs.size(); ++j) {
+                int via = arcs[i].weight + arcs[j].weight;
+                if (witnessDistance[arcs[j].to] > via) {
+                    shortcuts.push_back({arcs[i].to, arcs[j].to, via});
+                }
+            }
+            resetWitness();
+        }
+    };
+
+    std::vector<Shortcut> shortcuts;
+    auto priorityOf = [&](int v) {
+        findShortcuts(v, shortcuts);
+        return static_cast<int>(shortcuts.size()) - static_cast<int>(adjacency[v].size())
+               + contractedNeighbors[v];
+    };
+
+    auto addOrLowerArc = [&](int from, int to, int weight, int middle) {
+        for (Arc& arc : adjacency[from]) {
+            if (arc.to == to) {
+                if (weight < arc.weight) {
+                    arc.weight = weight;
+                    arc.middle = middle;
+                }
+                return;
+            }
+        }
+        adjacency[from].push_back({to, weight, middle});
+    };
+
+    MinHeap order;
+    for (int v = 0; v < numVertices; ++v) {
+        order.push({priorityOf(v), v});
+    }
+
+    int nextRank = 0;
+    while (!order.empty()) {
+        int v = order.top().second;
+        order.pop();
+
+        // Lazy update: re-evaluate and defer if v is no longer the cheapest
+        int priority = priorityOf(v);
+        if (!order.empty() && priority > order.top().first) {
+            order.push({priority, v});
+            continue;
+        }
+
+        rank[v] = nextRank++;
+        upward[v] = adjacency[v];
+        for (const Arc& arc : adjacency[v]) {
+            std::vector<Arc>& row = adjacency[arc.to];
+            row.erase(std::remove_if(row.begin(), row.end(),
+                                     [v](const Arc& a) { return a.to == v; }), row.end());
+            ++contractedNeighbors[arc.to];
+        }
+        for (const Shortcut& shortcut : shortcuts) {
+            addOrLowerArc(shortcut.from, shortcut.to, shortcut.weight, v);
+            addOrLowerArc(shortcut.to, shortcut.from, shortcut.weight, v);
+            ++shortcutCount;
+        }
+        adjacency[v].clear();
+        adjacency[v].shrink_to_fit();
+    }
+
+    upOffsets.assign(numVertices + 1, 0);
+    for (int v = 0; v < numVertices; ++v) {
+        std::sort(upward[v].begin(), upward[v].end(),
+                  [](const Arc& a, const Arc& b) { return a.to < b.to; });
+        upOffsets[v + 1] = upOffsets[v] + static_cast<int>(upward[v].size());
+    }
+    upArcs.reserve(upOffsets[numVertices]);
+    for (int v = 0; v < numVertices; ++v) {
+        upArcs.insert(upArcs.end(), upward[v].begin(), upward[v].end());
+    }
+}
+
+const ContractionHierarchy::Arc* ContractionHierarchy::findArc(int a, int b) const {
+    int lower = rank[a] < rank[b] ? a : b;
+    int higher = lower == a ? b : a;
+    auto first = upArcs.begin() + upOffsets[lower];
+    auto last = upArcs.begin() + upOffsets[lower + 1];
+    auto it = std::lower_bound(first, last, higher,
+                               [](const Arc& arc, int target) { return arc.to < target; });
+    if (it == last || it->to != higher) {
+        throw std::logic_error("Contraction hierarchy arc missing during unpacking");
+    }
+    return &*it;
+}
+
+void ContractionHierarchy::unpackArc(int a, int b, std::vector<int>& path) const {
+    std::vector<std::pair<int, int>> pending{{a, b}};
+    while (!pending.empty()) {
+        auto [from, to] = pending.back();
+        pending.pop_back();
+        const Arc* arc = findArc(from, to);
+        if (arc->middle == -1) {
+            path.push_back(to);
+        } else {
+            pending.push_back({arc->middle, to});
+            pending.push_back({from, arc->middle});
+        }
+    }
+}
+
+std::pair<int, std::vector<int>> ContractionHierarchy::findShortestPath(
+    int source, int destination, SearchStats* stats) const {
+    std::vector<int> path;
+    int distance = query(source, destination, stats, &path);
+    return {distance, path};
+}
+
+int ContractionHierarchy::query(int source, int destination, SearchStats* stats,
+                                std::vector<int>* path) const {
+    checkVertex(source);
+    checkVertex(destination);
+
+    QueryScratch& scratch = queryScratch;
+    scratch.prepare(numVertices);
+
+    MinHeap heaps[2];
+    const int roots[2] = {source, destination};
+    for (int side = 0; side < 2; ++side) {
+        scratch.distance[side][roots[side]] = 0;
+        heaps[side].push({0, roots[side]});
+    }
+    scratch.touched.push_back(source);
+    scratch.touched.push_back(destination);
+
+    int best = INF;
+    int meet = -1;
+
+    // Always expand the side with the smaller key; a side stops once its
+    // smallest key can no longer improve the best meeting distance
+    while (!heaps[0].empty() || !heaps[1].empty()) {
+        int side;
+        if (heaps[0].empty()) side = 1;
+        else if (heaps[1].empty()) side = 0;
+        else side = heaps[0].top().first <= heaps[1].top().first ? 0 : 1;
+
+        auto [dist, x] = heaps[side].top();
+        heaps[side].pop();
+        if (dist > scratch.distance[side][x]) continue;
+        if (dist >= best) {
+            heaps[side] = MinHeap();
+            continue;
+        }
+        if (stats) ++stats->settledVertices;
+
+        int other = scratch.distance[1 - side][x];
+        if (other != INF && dist + other < best) {
+            best = dist + other;
+            meet = x;
+        }
+
+        for (int i = upOffsets[x]; i < upOffsets[x + 1]; ++i) {
+            const Arc& arc = upArcs[i];
+            if (stats) ++stats->relaxedEdges;
+            int candidate = dist + arc.weight;
+            if (candidate < scratch.distance[side][arc.to]) {
+                if (scratch.distance[0][arc.to] == INF && scratch.distance[1][arc.to] == INF) {
+                    scratch.touched.push_back(arc.to);
+                }
+                scratch.distance[side][arc.to] = candidate;
+                scratch.parent[side][arc.to] = x;
+                heaps[side].push({candidate, arc.to});
+            }
+        }
+    }
+
+    if (path && meet != -1) {
+        // Hierarchy vertices from source up to the meeting vertex...
+        std::vector<int> up;
+        for (int v = meet; v != -1; v = scratch.parent[0][v]) up.push_back(v);
+        std::reverse(up.begin(), up.end());
+        // ...then down to the destination
+        for (int v = scratch.parent[1][meet]; v != -1; v = scratch.parent[1][v]) up.push_back(v);
+
+        path->push_back(up.front());
+        for (size_t i = 1; i < up.size(); ++i) {
+            unpackArc(up[i - 1], up[i], *path);
+        }
+    }
+
+    scratch.reset();
+    return best;
+}
+
+int ContractionHierarchy::findShortestDistance(int source, int destination) const {
+    return query(source, destination, nullptr, nullptr);
+}
+
+void ContractionHierarchy::upwardSearch(int root, std::vector<std::pair<int, int>>& space) const {
+    QueryScratch& scratch = queryScratch;
+    scratch.prepare(numVertices);
+    std::vector<int>& distance = scratch.distance[0];
+
+    space.clear();
+    MinHeap heap;
+    distance[root] = 0;
+    scratch.touched.push_back(root);
+    heap.push({0, root});
+
+    while (!heap.empty()) {
+        auto [dist, x] = heap.top();
+        heap.pop();
+        if (dist > distance[x]) continue;
+        space.push_back({x, dist});
+
+        for (int i = upOffsets[x]; i < upOffsets[x + 1]; ++i) {
+            const Arc& arc = upArcs[i];
+            int candidate = dist + arc.weight;
+            if (candidate < distance[arc.to]) {
+                if (distance[arc.to] == INF) scratch.touched.push_back(arc.to);
+                distance[arc.to] = candidate;
+                heap.push({candidate, arc.to});
+            }
+        }
+    }
+    scratch.reset();
+}
+
+std::vector<int> ContractionHierarchy::computeDistanceTable(const std::vector<int>& sources,
+                                                            const std::vector<int>& targets,
+                                                            unsigned numThreads) const {
+    for (int source : sources) checkVertex(source);
+    for (int target : targets) checkVertex(target);
+
+    const size_t targetCount = targets.size();
+    std::vector<int> table(sources.size() * targetCount, INF);
+    if (table.empty()) return table;
+
+    ParallelExecutor executor(numThreads);
+
+    // Backward phase: upward search spaces of every target (roads are
+    // undirected, so the backward hierarchy is the upward one)
+    std::vector<std::vector<std::pair<int, int>>> targetSpaces(targetCount);
+    executor.parallelFor(targetCount, [&](size_t j, unsigned) {
+        upwardSearch(targets[j], targetSpaces[j]);
+    });
+
+    // Bucket every (target, distance) entry at its vertex, CSR style, in
+    // target order so the table does not depend on thread timing
+    struct BucketEntry {
+        int target;
+        int distance;
+    };
+    std::vector<int> bucketOffsets(numVertices + 1, 0);
+    for (const auto& space : targetSpaces) {
+        for (const auto& settled : space) ++bucketOffsets[settled.first + 1];
+    }
+    for (int v = 0; v < numVertices; ++v) {
+        bucketOffsets[v + 1] += bucketOffsets[v];
+    }
+    std::vector<BucketEntry> buckets(bucketOffsets[numVertices]);
+    std::vector<int> fill(bucketOffsets.begin(), bucketOffsets.end() - 1);
+    for (size_t j = 0; j < targetCount; ++j) {
+        for (const auto& settled : targetSpaces[j]) {
+            buckets[fill[settled.first]++] = {static_cast<int>(j), settled.second};
+        }
+        std::vector<std::pair<int, int>>().swap(targetSpaces[j]);
+    }
+
+    // Forward phase: every source scans the buckets along its upward
+    // search space; each worker writes only the rows of its sources
+    std::vector<std::vector<std::pair<int, int>>> workerSpace(executor.getThreadCount());
+    executor.parallelFor(sources.size(), [&](size_t i, unsigned worker) {
+        std::vector<std::pair<int, int>>& space = workerSpace[worker];
+        upwardSearch(sources[i], space);
+        int* row = &table[i * targetCount];
+        for (const auto& settled : space) {
+            for (int b = bucketOffsets[settled.first]; b < bucketOffsets[settled.first + 1]; ++b) {
+                int candidate = settled.second + buckets[b].distance;
+                if (candidate < row[buckets[b].target]) row[buckets[b].target] = candidate;
+            }
+        }
+    });
+    return table;
+}
+
+int ContractionHierarchy::getRank(int vertex) const {
+    checkVertex(vertex);
+    return rank[vertex];
+}
@@ -0,0 +1,286 @@
+#include "DeltaStepping.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+
+// Distance in the high half and predecessor + 1 in the low half, so one
+// atomic minimum orders by distance and breaks ties by predecessor id
+using Label = unsigned long long;
+
+Label pack(int distance, int predecessor) {
+    return (static_cast<Label>(static_cast<unsigned>(distance)) << 32)
+           | static_cast<unsigned>(predecessor + 1);
+}
+
+int distanceOf(Label label) {
+    return static_cast<int>(label >> 32);
+}
+
+int predecessorOf(Label label) {
+    return static_cast<int>(label & 0xffffffffu) - 1;
+}
+
+/**
+ * @brief Reusable blocking barrier for a fixed number of threads
+ *
+ * Waiting threads sleep on a condition variable, so runs with more
+ * workers than cores do not spin on the cores the last arrival needs.
+ */
+class Barrier {
+private:
+    std::mutex mutex;
+    std::condition_variable released;
+    const unsigned count;
+    unsigned waiting;
+    unsigned long long generation;
+
+public:
+    explicit Barrier(unsigned threads) : count(threads), waiting(0), generation(0) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        unsigned long long arrivedIn = generation;
+        if (++waiting == count) {
+            waiting = 0;
+            ++generation;
+            lock.unlock();
+            released.notify_all();
+            return;
+        }
+        released.wait(lock, [&] { return generation != arrivedIn; });
+    }
+};
+
+}  // namespace
+
+DeltaStepping::DeltaStepping(const Graph& graph, int delta, unsigned threads)
+    : numVertices(graph.getVertexCount()), bucketWidth(delta), maxWeight(0), executor(threads) {
+    if (delta < 0) {
+        throw std::invalid_argument("Bucket width must be non-negative");
+    }
+
+    long long arcCount = 0;
+    for (int u = 0; u < numVertices; ++u) {
+        graph.forEachNeighbor(u, [&](int, int weight) {
+            if (weight < 0) {
+                throw std::invalid_argument("Delta-stepping requires non-negative weights");
+            }
+            maxWeight = std::max(maxWeight, weight);
+            ++arcCount;
+        });
+    }
+
+    // Meyer and Sanders: delta around max weight / average degree keeps
+    // light phases short without making buckets too fine
+    if (bucketWidth == 0) {
+        double averageDegree = numVertices > 0 ? static_cast<double>(arcCount) / numVertices : 1.0;
+        bucketWidth = std::max(1, static_cast<int>(maxWeight / std::max(1.0, averageDegree)));
+    }
+
+    rowOffsets.assign(numVertices + 1, 0);
+    lightEnd.assign(numVertices, 0);
+    neighbors.reserve(arcCount);
+    edgeWeights.reserve(arcCount);
+    std::vector<std::pair<int, int>> row;
+    for (int u = 0; u < numVertices; ++u) {
+        row.clear();
+        graph.forEachNeighbor(u, [&](int v, int weight) { row.push_back({v, weight}); });
+        auto heavy = std::stable_partition(row.begin(), row.end(),
+            [this](const std::pair<int, int>& arc) { return arc.second <= bucketWidth; });
+
+        lightEnd[u] = rowOffsets[u] + static_cast<int>(heavy - row.begin());
+        for (const auto& arc : row) {
+            neighbors.push_back(arc.first);
+            edgeWeights.push_back(arc.second);
+        }
+        rowOffsets[u + 1] = static_cast<int>(neighbors.size());
+    }
+}
+
+void DeltaStepping::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= numVertices) {
+        throw std::out_of_range("Invalid vertex index");
+    }
+}
+
+void DeltaStepping::run(int source, int target, std::vector<int>& distance,
+                        std::vector<int>& previous, SearchStats* stats) const {
+    const unsigned workers = executor.getThreadCount();
+    const int delta = bucketWidth;
+    // Pending distances never exceed the current bucket by more than
+    // maxWeight, so a ring of this many buckets is enough
+    const size_t slots = static_cast<size_t>(maxWeight / delta) + 2;
+
+    std::vector<std::atomic<Label>> labels(numVertices);
+    for (auto& label : labels) {
+        label.store(pack(INF, -1), std::memory_order_relaxed);
+    }
+    labels[source].store(pack(0, -1), std::memory_order_relaxed);
+
+    std::vector<std::vector<int>> buckets(slots);
+    std::vector<int> frontier{source};
+    std::vector<int> settled;
+    std::vector<int> queuedRound(numVertices, -1);
+    std::vector<int> settledBucket(numVertices, -1);
+    std::vector<std::vector<int>> improved(workers);
+    std::vector<long long> relaxedEdges(workers, 0);
+    long long settledVertices = 0;
+    int current = 0;
+    int round = 0;
+    bool done = false;
+    queuedRound[source] = round;
+
+    auto bucketOf = [&](int v) {
+        return distanceOf(labels[v].load(std::memory_order_relaxed)) / delta;
+    };
+
+    // Relaxes the light or heavy arcs of this worker's share of items
+    auto relax = [&](const std::vector<int>& items, bool light, unsigned worker) {
+        size_t share = (items.size() + workers - 1) / workers;
+        size_t begin = std::min(items.size(), share * worker);
+        size_t end = std::min(items.size(), begin + share);
+        std::vector<int>& out = improved[worker];
+
+        for (size_t i = begin; i < end; ++i) {
+            int u = items[i];
+            int d = distanceOf(labels[u].load(std::memory_order_relaxed));
+            int first = light ? rowOffsets[u] : lightEnd[u];
+            int last = light ? lightEnd[u] : rowOffsets[u + 1];
+            relaxedEdges[worker] += last - first;
+            for (int a = first; a < last; ++a) {
+                int v = neighbors[a];
+                Label offer = pack(d + edgeWeights[a], u);
+                Label seen = labels[v].load(std::memory_order_relaxed);
+                // A zero-weight arc may only improve the distance: swapping
+                // predecessors on a tie there could close a cycle
+                bool tieBreaks = edgeWeights[a] > 0;
+                while (offer < seen && (tieBreaks || distanceOf(offer) < distanceOf(seen))) {
+                    if (labels[v].compare_exchange_weak(seen, offer, std::memory_order_relaxed)) {
+                        if (distanceOf(offer) < distanceOf(seen)) out.push_back(v);
+                        break;
+                    }
+                }
+            }
+        }
+    };
+
+    // Worker 0 only: route improved vertices to the frontier or their buckets
+    auto distribute = [&](bool light) {
+        if (light) {
+            for (int v : frontier) {
+                if (settledBucket[v] != current) {
+                    settledBucket[v] = current;
+                    settled.push_back(v);
+                    ++settledVertices;
+                }
+            }
+            frontier.clear();
+            ++round;
+        }
+        for (std::vector<int>& out : improved) {
+            for (int v : out) {
+                int b = bucketOf(v);
+                if (light && b == current) {
+                    if (queuedRound[v] != round) {
+                        queuedRound[v] = round;
+                        frontier.push_back(v);
+                    }
+                } else {
+                    buckets[b % slots].push_back(v);
+                }
+            }
+            out.clear();
+        }
+    };
+
+    // Worker 0 only: move to the next non-empty bucket, skipping stale entries
+    auto advance = [&]() {
+        settled.clear();
+        if (target != -1 && bucketOf(target) <= current) {
+            done = true;
+            return;
+        }
+        ++round;
+        for (size_t step = 1; step <= slots && frontier.empty(); ++step) {
+            int b = current + static_cast<int>(step);
+            std::vector<int>& slot = buckets[b % slots];
+            for (int v : slot) {
+                if (bucketOf(v) == b && queuedRound[v] != round) {
+                    queuedRound[v] = round;
+                    frontier.push_back(v);
+                }
+            }
+            slot.clear();
+            if (!frontier.empty()) current = b;
+        }
+        done = frontier.empty();
+    };
+
+    Barrier barrier(workers);
+    executor.parallelRegion([&](unsigned worker) {
+        while (true) {
+            // Light arcs can refill the current bucket; repeat until it stays empty
+            while (true) {
+                relax(frontier, true, worker);
+                barrier.wait();
+                if (worker == 0) distribute(true);
+                barrier.wait();
+                if (frontier.empty()) break;
+            }
+
+            // Heavy arcs of everything settled in this bucket reach later buckets only
+            relax(settled, false, worker);
+            barrier.wait();
+            if (worker == 0) {
+                distribute(false);
+                advance();
+            }
+            barrier.wait();
+            if (done) break;
+        }
+    });
+
+    for (int v = 0; v < numVertices; ++v) {
+        Label label = labels[v].load(std::memory_order_relaxed);
+        distance[v] = distanceOf(label);
+        previous[v] = predecessorOf(label);
+    }
+
+    if (stats) {
+        stats->settledVertices += static_cast<int>(settledVertices);
+        for (long long count : relaxedEdges) stats->relaxedEdges += static_cast<int>(count);
+    }
+}
+
+ShortestPathTree DeltaStepping::computeShortestPathTree(int source, SearchStats* stats) const {
+    checkVertex(source);
+    std::vector<int> distance(numVertices, INF);
+    std::vector<int> previous(numVertices, -1);
+    run(source, -1, distance, previous, stats);
+    return ShortestPathTree(source, std::move(distance), std::move(previous));
+}
+
+std::pair<int, std::vector<int>> DeltaStepping::findShortestPath(int source, int destination,
+                                                                 SearchStats* stats) const {
+    checkVertex(source);
+    checkVertex(destination);
+    std::vector<int> distance(numVertices, INF);
+    std::vector<int> previous(numVertices, -1);
+    run(source, destination, distance, previous, stats);
+
+    std::vector<int> path;
+    if (distance[destination] != INF) {
+        for (int current = destination; current != -1; current = previous[current]) {
+            path.push_back(current);
+        }
+        std::reverse(path.begin(), path.end());
+    }
+    return {distance[destination], path};
+}
@@ -0,0 +1,197 @@
+#include "DynamicShortestPathTree.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+
+using HeapEntry = std::pair<int, int>;
+using MinHeap = std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>>;
+
+}  // namespace
+
+DynamicShortestPathTree::DynamicShortestPathTree(Graph& network, int sourceVertex)
+    : graph(network), source(sourceVertex), syncedVersion(0), lastUpdatedVertices(0) {
+    refresh();
+}
+
+void DynamicShortestPathTree::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= static_cast<int>(distance.size())) {
+        throw std::out_of_range("Invalid vertex index");
+    }
+}
+
+void DynamicShortestPathTree::refresh() {
+    ShortestPathTree tree = graph.computeShortestPathTree(source, ShortestPathEngine::BinaryHeap);
+    distance = tree.getDistances();
+    previous = tree.getPredecessors();
+    syncedVersion = graph.getVersion();
+    lastUpdatedVertices = static_cast<int>(distance.size());
+}
+
+int DynamicShortestPathTree::addEdge(int from, int to, int weight) {
+    bool stale = isStale();
+    graph.addEdge(from, to, weight);
+    if (stale) {
+        refresh();
+        return lastUpdatedVertices;
+    }
+    syncedVersion = graph.getVersion();
+
+    // The graph keeps the lighter of parallel roads, so repair with the
+    // weight it actually stores
+    int stored = graph.getEdgeWeight(from, to);
+    lastUpdatedVertices = repair(from, to, stored) + repair(to, from, stored);
+    return lastUpdatedVertices;
+}
+
+int DynamicShortestPathTree::removeEdge(int from, int to) {
+    bool stale = isStale();
+    bool removed = graph.removeEdge(from, to);
+    if (stale) {
+        refresh();
+        return lastUpdatedVertices;
+    }
+    syncedVersion = graph.getVersion();
+    lastUpdatedVertices = removed ? repairSubtree(from, to) : 0;
+    return lastUpdatedVertices;
+}
+
+int DynamicShortestPathTree::setEdgeWeight(int from, int to, int weight) {
+    bool stale = isStale();
+    int old = graph.getEdgeWeight(from, to);
+    graph.setEdgeWeight(from, to, weight);
+    if (stale) {
+        refresh();
+        return lastUpdatedVertices;
+    }
+    syncedVersion = graph.getVersion();
+
+    if (weight < old) {
+        lastUpdatedVertices = repair(from, to, weight) + repair(to, from, weight);
+    } else if (weight > old) {
+        lastUpdatedVertices = repairSubtree(from, to);
+    } else {
+        lastUpdatedVertices = 0;
+    }
+    return lastUpdatedVertices;
+}
+
+int DynamicShortestPathTree::repair(int from, int to, int weight) {
+    if (from == to || distance[from] == INF) return 0;
+    int candidate = distance[from] + weight;
+    if (candidate >= distance[to]) return 0;
+
+    distance[to] = candidate;
+    previous[to] = from;
+    int updated = 0;
+
+    // Dijkstra restricted to vertices whose distance actually improves;
+    // everything else keeps its old, still optimal, route
+    MinHeap heap;
+    heap.push({candidate, to});
+    while (!heap.empty()) {
+        auto [dist, u] = heap.top();
+        heap.pop();
+        if (dist > distance[u]) continue;
+        ++updated;
+
+        graph.forEachNeighbor(u, [&](int v, int w) {
+            int next = dist + w;
+            if (next < distance[v]) {
+                distance[v] = next;
+                previous[v] = u;
+                heap.push({next, v});
+            }
+        });
+    }
+    return updated;
+}
+
+int DynamicShortestPathTree::repairSubtree(int from, int to) {
+    // Only a tree edge carries routes; its lower endpoint roots the damage
+    int root = previous[to] == from ? to : previous[from] == to ? from : -1;
+    if (root == -1) return 0;
+
+    // Collect the subtree; tree children are graph neighbors pointing back at their parent
+    std::vector<int> subtree(1, root);
+    for (size_t i = 0; i < subtree.size(); ++i) {
+        int u = subtree[i];
+        graph.forEachNeighbor(u, [&](int v, int) {
+            if (previous[v] == u) subtree.push_back(v);
+        });
+    }
+
+    std::vector<int> oldDistance(subtree.size());
+    for (size_t i = 0; i < subtree.size(); ++i) {
+        oldDistance[i] = distance[subtree[i]];
+        distance[subtree[i]] = INF;
+        previous[subtree[i]] = -1;
+    }
+
+    // Seed every subtree vertex with its best entry from a neighbor that
+    // has a distance. Outside the subtree those distances are still
+    // optimal; inside, they are real routes that the search below improves.
+    MinHeap heap;
+    for (int v : subtree) {
+        graph.forEachNeighbor(v, [&](int u, int w) {
+            if (distance[u] != INF && distance[u] + w < distance[v]) {
+                distance[v] = distance[u] + w;
+                previous[v] = u;
+            }
+        });
+        if (distance[v] != INF) heap.push({distance[v], v});
+    }
+
+    // Vertices outside the subtree never improve, so the search stays inside it
+    while (!heap.empty()) {
+        auto [dist, u] = heap.top();
+        heap.pop();
+        if (dist > distance[u]) continue;
+
+        graph.forEachNeighbor(u, [&](int v, int w) {
+            int next = dist + w;
+            if (next < distance[v]) {
+                distance[v] = next;
+                previous[v] = u;
+                heap.push({next, v});
+            }
+        });
+    }
+
+    int updated = 0;
+    for (size_t i = 0; i < subtree.size(); ++i) {
+        if (distance[subtree[i]] != oldDistance[i]) ++updated;
+    }
+    return updated;
+}
+
+int DynamicShortestPathTree::distanceTo(int destination) const {
+    checkVertex(destination);
+    return distance[destination];
+}
+
+int DynamicShortestPathTree::predecessorOf(int vertex) const {
+    checkVertex(vertex);
+    return previous[vertex];
+}
+
+std::vector<int> DynamicShortestPathTree::pathTo(int destination) const {
+    checkVertex(destination);
+    std::vector<int> path;
+    if (distance[destination] == INF) return path;
+
+    for (int current = destination; current != -1; current = previous[current]) {
+        path.push_back(current);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+ShortestPathTree DynamicShortestPathTree::snapshot() const {
+    return ShortestPathTree(source, distance, previous);
+}
@@ -2,43 +2,1251 @@
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include "ParallelExecutor.h"
+#include "SimdKernels.h"
+#include "BucketQueue.h"
+#include "RadixHeap.h"
+#include "RouteLength.h"
 
-// Define the static constant
+// Define the static constants
 const int Graph::INF;
+const int Graph::BUCKET_QUEUE_WEIGHT_LIMIT;
 
-Graph::Graph(int vertices) : numVertices(vertices) {
-    adjacencyMatrix.resize(vertices, std::vector<int>(vertices, INF));
-    
-    // Initialize diagonal elements to 0
-    for (int i = 0; i < vertices; ++i) {
-        adjacencyMatrix[i][i] = 0;
+namespace {
+
+/**
+ * @brief Adapts caller-provided distance/previous arrays to runHeapSearch
+ */
+struct ArrayLabels {
+    std::vector<int>& distance;
+    std::vector<int>& previous;
+    std::vector<std::pair<int, int>> heap;
+
+    int distanceTo(int v) const { return distance[v]; }
+    void update(int v, int d, int parent) {
+        distance[v] = d;
+        previous[v] = parent;
+    }
+    std::vector<std::pair<int, int>>& heapStorage() { return heap; }
+};
+
+/**
+ * @brief Distance-only view of a QueryWorkspace for runHeapSearch
+ */
+struct DistanceLabels {
+    QueryWorkspace& workspace;
+
+    int distanceTo(int v) const { return workspace.distanceTo(v); }
+    void update(int v, int d, int) { workspace.updateDistance(v, d); }
+    std::vector<std::pair<int, int>>& heapStorage() { return workspace.heapStorage(); }
+};
+
+/**
+ * @brief Binary min-heap of (distance, vertex) in a caller-owned buffer
+ */
+struct BinaryHeapQueue {
+    std::vector<std::pair<int, int>>& heap;
+
+    bool empty() const { return heap.empty(); }
+    void push(int key, int vertex) {
+        heap.push_back({key, vertex});
+        std::push_heap(heap.begin(), heap.end(), std::greater<std::pair<int, int>>());
+    }
+    std::pair<int, int> pop() {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<std::pair<int, int>>());
+        std::pair<int, int> top = heap.back();
+        heap.pop_back();
+        return top;
+    }
+};
+
+// Backs findShortestPath so repeated queries on a thread reuse one workspace
+thread_local QueryWorkspace threadWorkspace;
+
+// Integer queues reused by the BucketQueue and RadixHeap engines on each thread
+thread_local BucketQueue threadBuckets;
+thread_local RadixHeap threadRadixHeap;
+
+}  // namespace
+
+Graph::Graph(int vertices, GraphStorage storageMode, ShortestPathEngine engine)
+    : storage(storageMode), defaultEngine(engine), numVertices(vertices), maxEdgeWeight(0), csrDirty(false),
+      landmarksDirty(false), version(0), componentCount(vertices), cacheCapacity(0), cacheVersion(0),
+      cacheHits(0), cacheMisses(0) {
+    if (vertices < 0) {
+        throw std::invalid_argument("Vertex count must be non-negative");
+    }
+
+    componentParent.resize(vertices);
+    std::iota(componentParent.begin(), componentParent.end(), 0);
+    componentSize.assign(vertices, 1);
+
+    if (storage == GraphStorage::Dense) {
+        adjacencyMatrix.resize(vertices, std::vector<int>(vertices, INF));
+
+        // Initialize diagonal elements to 0
+        for (int i = 0; i < vertices; ++i) {
+            adjacencyMatrix[i][i] = 0;
+        }
+    } else {
+        rowOffsets.assign(vertices + 1, 0);
+    }
+}
+
+void Graph::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= numVertices) {
+        throw std::out_of_range("Invalid vertex index");
     }
 }
 
+Graph Graph::fromEdges(int vertices, const std::vector<Edge>& edges,
+                       GraphStorage storageMode, ShortestPathEngine engine) {
+    Graph graph(vertices, storageMode, engine);
+    if (storageMode == GraphStorage::Dense) {
+        for (const Edge& edge : edges) {
+            graph.addEdge(edge.from, edge.to, edge.weight);
+        }
+        return graph;
+    }
+
+    // Count the degree of every vertex, then turn counts into row starts
+    std::vector<int>& offsets = graph.rowOffsets;
+    for (const Edge& edge : edges) {
+        if (edge.from < 0 || edge.from >= vertices || edge.to < 0 || edge.to >= vertices) {
+            throw std::out_of_range("Invalid vertex index");
+        }
+        if (edge.from == edge.to) continue;
+        graph.maxEdgeWeight = std::max(graph.maxEdgeWeight, edge.weight);
+        ++offsets[edge.from + 1];
+        ++offsets[edge.to + 1];
+        graph.uniteComponents(edge.from, edge.to);
+    }
+    for (int u = 0; u < vertices; ++u) {
+        offsets[u + 1] += offsets[u];
+    }
+
+    // Scatter both directions of every road into their rows; afterwards
+    // offsets[u] has advanced to the end of row u, i.e. the start of row u + 1
+    std::vector<std::pair<int, int>> arcs(offsets[vertices]);
+    for (const Edge& edge : edges) {
+        if (edge.from == edge.to) continue;
+        arcs[offsets[edge.from]++] = {edge.to, edge.weight};
+        arcs[offsets[edge.to]++] = {edge.from, edge.weight};
+    }
+    for (int u = vertices; u > 0; --u) {
+        offsets[u] = offsets[u - 1];
+    }
+    offsets[0] = 0;
+
+    // Sort each row by (neighbor, weight) and keep the first, lightest arc
+    // of every run, compacting towards the front of the buffer
+    int write = 0;
+    int begin = 0;
+    for (int u = 0; u < vertices; ++u) {
+        int end = offsets[u + 1];
+        std::sort(arcs.begin() + begin, arcs.begin() + end);
+        int previousNeighbor = -1;
+        for (int i = begin; i < end; ++i) {
+            if (arcs[i].first == previousNeighbor) continue;
+            previousNeighbor = arcs[i].first;
+            arcs[write++] = arcs[i];
+        }
+        offsets[u + 1] = write;
+        begin = end;
+    }
+
+    graph.neighbors.resize(write);
+    graph.edgeWeights.resize(write);
+    for (int i = 0; i < write; ++i) {
+        graph.neighbors[i] = arcs[i].first;
+        graph.edgeWeights[i] = arcs[i].second;
+    }
+    return graph;
+}
+
 void Graph::addEdge(int from, int to, int weight) {
     if (from < 0 || from >= numVertices || to < 0 || to >= numVertices) {
         throw std::out_of_range("Invalid vertex index");
     }
-    
-    // For undirected graph, add edge in both directions
-    if (adjacencyMatrix[from][to] == INF || adjacencyMatrix[from][to] > weight) {
+
+    // A shorter road can invalidate landmark lower bounds and cached routes
+    landmarksDirty = !landmarks.empty();
+    ++version;
+    uniteComponents(from, to);
+    maxEdgeWeight = std::max(maxEdgeWeight, weight);
+
+    if (storage == GraphStorage::Dense) {
+        // For undirected graph, add edge in both directions
+        if (adjacencyMatrix[from][to] == INF || adjacencyMatrix[from][to] > weight) {
+            adjacencyMatrix[from][to] = weight;
+            adjacencyMatrix[to][from] = weight;
+        }
+        return;
+    }
+
+    // Self loops never shorten a route
+    if (from == to) return;
+
+    // Lower an existing arc pair in place; anything new is merged lazily
+    std::lock_guard<std::mutex> lock(compactionLock.mutex);
+    int forward = findArc(from, to);
+    if (forward != -1) {
+        if (weight < edgeWeights[forward]) {
+            edgeWeights[forward] = weight;
+            edgeWeights[findArc(to, from)] = weight;
+        }
+        return;
+    }
+    pendingEdges.push_back({from, to, weight});
+    csrDirty = true;
+}
+
+bool Graph::removeEdge(int from, int to) {
+    checkVertex(from);
+    checkVertex(to);
+    if (from == to) return false;
+
+    if (storage == GraphStorage::Dense) {
+        if (adjacencyMatrix[from][to] == INF) return false;
+        adjacencyMatrix[from][to] = INF;
+        adjacencyMatrix[to][from] = INF;
+    } else {
+        std::lock_guard<std::mutex> lock(compactionLock.mutex);
+        if (csrDirty) {
+            rebuildCsr();
+        }
+        if (findArc(from, to) == -1) return false;
+        eraseArc(from, to);
+        eraseArc(to, from);
+    }
+
+    // A longer detour can break landmark lower bounds as well as cached routes
+    landmarksDirty = !landmarks.empty();
+    ++version;
+    rebuildComponents();
+    return true;
+}
+
+void Graph::setEdgeWeight(int from, int to, int weight) {
+    checkVertex(from);
+    checkVertex(to);
+
+    if (storage == GraphStorage::Dense) {
+        if (from == to || adjacencyMatrix[from][to] == INF) {
+            throw std::invalid_argument("No road between the given vertices");
+        }
         adjacencyMatrix[from][to] = weight;
         adjacencyMatrix[to][from] = weight;
+    } else {
+        std::lock_guard<std::mutex> lock(compactionLock.mutex);
+        if (csrDirty) {
+            rebuildCsr();
+        }
+        int forward = from == to ? -1 : findArc(from, to);
+        if (forward == -1) {
+            throw std::invalid_argument("No road between the given vertices");
+        }
+        edgeWeights[forward] = weight;
+        edgeWeights[findArc(to, from)] = weight;
     }
+
+    landmarksDirty = !landmarks.empty();
+    ++version;
+    maxEdgeWeight = std::max(maxEdgeWeight, weight);
 }
 
-std::pair<int, std::vector<int>> Graph::findShortestPath(int source, int destination) {
+int Graph::findComponent(int vertex) const {
+    while (componentParent[vertex] != vertex) {
+        vertex = componentParent[vertex];
+    }
+    return vertex;
+}
+
+void Graph::uniteComponents(int a, int b) {
+    // Path halving: point every other vertex on the way at its grandparent
+    for (int* v : {&a, &b}) {
+        while (componentParent[*v] != *v) {
+            componentParent[*v] = componentParent[componentParent[*v]];
+            *v = componentParent[*v];
+        }
+    }
+    if (a == b) return;
+
+    if (componentSize[a] < componentSize[b]) std::swap(a, b);
+    componentParent[b] = a;
+    componentSize[a] += componentSize[b];
+    --componentCount;
+}
+
+void Graph::rebuildComponents() {
+    std::iota(componentParent.begin(), componentParent.end(), 0);
+    componentSize.assign(numVertices, 1);
+    componentCount = numVertices;
+    for (int u = 0; u < numVertices; ++u) {
+        visitNeighbors(u, [&](int v, int) {
+            if (u < v) uniteComponents(u, v);
+        });
+    }
+}
+
+bool Graph::isConnected(int a, int b) const {
+    checkVertex(a);
+    checkVertex(b);
+    return findComponent(a) == findComponent(b);
+}
+
+int Graph::findArc(int from, int to) const {
+    auto first = neighbors.begin() + rowOffsets[from];
+    auto last = neighbors.begin() + rowOffsets[from + 1];
+    auto it = std::lower_bound(first, last, to);
+    if (it == last || *it != to) return -1;
+    return static_cast<int>(it - neighbors.begin());
+}
+
+void Graph::eraseArc(int from, int to) {
+    int arc = findArc(from, to);
+    neighbors.erase(neighbors.begin() + arc);
+    edgeWeights.erase(edgeWeights.begin() + arc);
+    for (int u = from + 1; u <= numVertices; ++u) {
+        --rowOffsets[u];
+    }
+}
+
+void Graph::ensureCompacted() const {
+    if (storage == GraphStorage::Dense) return;
+
+    std::lock_guard<std::mutex> lock(compactionLock.mutex);
+    if (csrDirty) {
+        rebuildCsr();
+    }
+}
+
+void Graph::rebuildCsr() const {
+    // Sort only the pending arcs (both directions of each edge) by
+    // (from, to, weight) so the first arc of each run has the minimum weight
+    std::vector<Edge> arcs;
+    arcs.reserve(pendingEdges.size() * 2);
+    for (const Edge& edge : pendingEdges) {
+        arcs.push_back({edge.from, edge.to, edge.weight});
+        arcs.push_back({edge.to, edge.from, edge.weight});
+    }
+    std::sort(arcs.begin(), arcs.end(), [](const Edge& a, const Edge& b) {
+        if (a.from != b.from) return a.from < b.from;
+        if (a.to != b.to) return a.to < b.to;
+        return a.weight < b.weight;
+    });
+    arcs.erase(std::unique(arcs.begin(), arcs.end(), [](const Edge& a, const Edge& b) {
+        return a.from == b.from && a.to == b.to;
+    }), arcs.end());
+
+    // Merge them row by row into the already sorted CSR arrays, so a small
+    // batch of new roads costs O(V + E) rather than a full re-sort
+    std::vector<int> mergedOffsets(numVertices + 1, 0);
+    std::vector<int> mergedNeighbors;
+    std::vector<int> mergedWeights;
+    mergedNeighbors.reserve(neighbors.size() + arcs.size());
+    mergedWeights.reserve(neighbors.size() + arcs.size());
+
+    size_t next = 0;
+    for (int u = 0; u < numVertices; ++u) {
+        int i = rowOffsets[u];
+        const int rowEnd = rowOffsets[u + 1];
+        while (i < rowEnd || (next < arcs.size() && arcs[next].from == u)) {
+            bool takePending = next < arcs.size() && arcs[next].from == u
+                               && (i == rowEnd || arcs[next].to <= neighbors[i]);
+            if (!takePending) {
+                mergedNeighbors.push_back(neighbors[i]);
+                mergedWeights.push_back(edgeWeights[i]);
+                ++i;
+                continue;
+            }
+            int weight = arcs[next].weight;
+            if (i < rowEnd && neighbors[i] == arcs[next].to) {
+                weight = std::min(weight, edgeWeights[i]);
+                ++i;
+            }
+            mergedNeighbors.push_back(arcs[next].to);
+            mergedWeights.push_back(weight);
+            ++next;
+        }
+        mergedOffsets[u + 1] = static_cast<int>(mergedNeighbors.size());
+    }
+
+    rowOffsets.swap(mergedOffsets);
+    neighbors.swap(mergedNeighbors);
+    edgeWeights.swap(mergedWeights);
+
+    pendingEdges.clear();
+    pendingEdges.shrink_to_fit();
+    csrDirty = false;
+}
+
+std::pair<int, std::vector<int>> Graph::findShortestPath(int source, int destination) const {
+    return findShortestPath(source, destination, defaultEngine);
+}
+
+std::pair<int, std::vector<int>> Graph::findShortestPath(int source, int destination,
+                                                         ShortestPathEngine engine,
+                                                         SearchStats* stats) const {
     if (source < 0 || source >= numVertices || destination < 0 || destination >= numVertices) {
         throw std::out_of_range("Invalid vertex index");
     }
+    std::pair<int, std::vector<int>> result;
+    if (findComponent(source) != findComponent(destination)) {
+        result.first = INF;
+        return result;
+    }
+    bool cacheable = stats == nullptr && cacheCapacity > 0;
+    if (cacheable && lookupCachedRoute(source, destination, result)) {
+        return result;
+    }
+
+    ShortestPathEngine resolved = resolveEngine(engine);
+    if (isLabelSetting(resolved)) {
+        ensureCompacted();
+        threadWorkspace.reset(numVertices);
+        runHeapSearch(resolved, source, destination, threadWorkspace, stats);
+        result = {threadWorkspace.distanceTo(destination), threadWorkspace.pathTo(destination)};
+    } else {
+        ensureCompacted();
+        std::vector<int> distance(numVertices, INF);
+        std::vector<int> previous(numVertices, -1);
+        runSearch(engine, source, destination, distance, previous, stats);
+        result = {distance[destination], buildPath(previous, distance, destination)};
+    }
+
+    if (cacheable) {
+        storeCachedRoute(source, destination, result);
+    }
+    return result;
+}
+
+std::pair<int, std::vector<int>> Graph::findShortestPath(int source, int destination,
+                                                         QueryWorkspace& workspace,
+                                                         SearchStats* stats) const {
+    if (!isConnected(source, destination)) {
+        return {INF, {}};
+    }
+    ensureCompacted();
+
+    ShortestPathEngine engine = resolveEngine(defaultEngine);
+    if (!isLabelSetting(engine)) engine = ShortestPathEngine::BinaryHeap;
+
+    workspace.reset(numVertices);
+    runHeapSearch(engine, source, destination, workspace, stats);
+    return {workspace.distanceTo(destination), workspace.pathTo(destination)};
+}
+
+int Graph::findShortestDistance(int source, int destination) const {
+    return findShortestDistance(source, destination, defaultEngine);
+}
+
+int Graph::findShortestDistance(int source, int destination, ShortestPathEngine engine,
+                                SearchStats* stats) const {
+    if (!isConnected(source, destination)) {
+        return INF;
+    }
+    ensureCompacted();
+
+    runDistanceSearch(engine, source, destination, threadWorkspace, stats);
+    return threadWorkspace.distanceTo(destination);
+}
+
+void Graph::runDistanceSearch(ShortestPathEngine engine, int source, int target,
+                              QueryWorkspace& workspace, SearchStats* stats) const {
+    workspace.reset(numVertices);
+    ShortestPathEngine resolved = resolveEngine(engine);
+    if (isLabelSetting(resolved)) {
+        DistanceLabels labels{workspace};
+        runHeapSearch(resolved, source, target, labels, stats);
+        return;
+    }
+
+    std::vector<int> distance(numVertices, INF);
+    if (resolved == ShortestPathEngine::LinearScan) {
+        // Dense graphs default to the linear scan; skip its predecessor writes
+        runLinearScan(source, target, distance, nullptr, stats);
+    } else {
+        std::vector<int> previous(numVertices, -1);
+        runSearch(engine, source, target, distance, previous, stats);
+    }
+    if (target != -1) {
+        workspace.updateDistance(target, distance[target]);
+        return;
+    }
+    for (int v = 0; v < numVertices; ++v) {
+        if (distance[v] != INF) workspace.updateDistance(v, distance[v]);
+    }
+}
+
+void Graph::enableRouteCache(size_t capacity) {
+    std::lock_guard<std::mutex> lock(cacheLock.mutex);
+    cacheCapacity = capacity;
+    cacheEntries.clear();
+    cacheIndex.clear();
+    cacheVersion = version;
+    cacheHits = 0;
+    cacheMisses = 0;
+}
+
+size_t Graph::getCacheHits() const {
+    std::lock_guard<std::mutex> lock(cacheLock.mutex);
+    return cacheHits;
+}
+
+size_t Graph::getCacheMisses() const {
+    std::lock_guard<std::mutex> lock(cacheLock.mutex);
+    return cacheMisses;
+}
+
+bool Graph::lookupCachedRoute(int source, int destination,
+                              std::pair<int, std::vector<int>>& result) const {
+    std::lock_guard<std::mutex> lock(cacheLock.mutex);
+    if (cacheVersion != version) {
+        cacheEntries.clear();
+        cacheIndex.clear();
+        cacheVersion = version;
+    }
+
+    long long key = static_cast<long long>(std::min(source, destination)) * numVertices
+                    + std::max(source, destination);
+    auto found = cacheIndex.find(key);
+    if (found == cacheIndex.end()) {
+        ++cacheMisses;
+        return false;
+    }
+
+    ++cacheHits;
+    cacheEntries.splice(cacheEntries.begin(), cacheEntries, found->second);
+    result.first = found->second->distance;
+    result.second = found->second->path;
+    if (source > destination) {
+        std::reverse(result.second.begin(), result.second.end());
+    }
+    return true;
+}
+
+void Graph::storeCachedRoute(int source, int destination,
+                             const std::pair<int, std::vector<int>>& result) const {
+    std::lock_guard<std::mutex> lock(cacheLock.mutex);
+    if (cacheVersion != version) return;
+
+    long long key = static_cast<long long>(std::min(source, destination)) * numVertices
+                    + std::max(source, destination);
+    if (cacheIndex.count(key)) return;
+
+    CachedRoute entry{key, result.first, result.second};
+    if (source > destination) {
+        std::reverse(entry.path.begin(), entry.path.end());
+    }
+    cacheEntries.push_front(std::move(entry));
+    cacheIndex[key] = cacheEntries.begin();
+    if (cacheEntries.size() > cacheCapacity) {
+        cacheIndex.erase(cacheEntries.back().key);
+        cacheEntries.pop_back();
+    }
+}
+
+std::vector<std::pair<int, std::vector<int>>> Graph::findShortestPaths(
+    const std::vector<std::pair<int, int>>& queries, unsigned numThreads) const {
+    for (const auto& query : queries) {
+        checkVertex(query.first);
+        checkVertex(query.second);
+    }
+    ensureCompacted();
+
+    // Group query indices by source so each source is searched once
+    std::vector<size_t> order(queries.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return queries[a].first < queries[b].first;
+    });
+    std::vector<size_t> groupStart;
+    for (size_t i = 0; i < order.size(); ++i) {
+        if (i == 0 || queries[order[i]].first != queries[order[i - 1]].first) {
+            groupStart.push_back(i);
+        }
+    }
+    groupStart.push_back(order.size());
+
+    std::vector<std::pair<int, std::vector<int>>> results(queries.size());
+    ParallelExecutor executor(numThreads);
+    std::vector<std::vector<int>> workerDistance(executor.getThreadCount());
+    std::vector<std::vector<int>> workerPrevious(executor.getThreadCount());
+
+    executor.parallelFor(groupStart.size() - 1, [&](size_t group, unsigned worker) {
+        size_t first = groupStart[group], last = groupStart[group + 1];
+        int source = queries[order[first]].first;
+
+        // Destinations in other components need no search at all
+        const int root = findComponent(source);
+        if (std::none_of(order.begin() + first, order.begin() + last,
+                         [&](size_t i) { return findComponent(queries[i].second) == root; })) {
+            for (size_t i = first; i < last; ++i) results[order[i]] = {INF, {}};
+            return;
+        }
+
+        // A single destination can stop early; several need the full tree
+        int target = queries[order[first]].second;
+        for (size_t i = first + 1; i < last; ++i) {
+            if (queries[order[i]].second != target) {
+                target = -1;
+                break;
+            }
+        }
+
+        std::vector<int>& distance = workerDistance[worker];
+        std::vector<int>& previous = workerPrevious[worker];
+        distance.assign(numVertices, INF);
+        previous.assign(numVertices, -1);
+        runSearch(defaultEngine, source, target, distance, previous, nullptr);
+
+        for (size_t i = first; i < last; ++i) {
+            int destination = queries[order[i]].second;
+            results[order[i]] = {distance[destination], buildPath(previous, distance, destination)};
+        }
+    });
+
+    return results;
+}
+
+std::vector<int> Graph::findShortestDistances(const std::vector<std::pair<int, int>>& queries,
+                                             unsigned numThreads) const {
+    for (const auto& query : queries) {
+        checkVertex(query.first);
+        checkVertex(query.second);
+    }
+    ensureCompacted();
+
+    // Group query indices by source so each source is searched once
+    std::vector<size_t> order(queries.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return queries[a].first < queries[b].first;
+    });
+    std::vector<size_t> groupStart;
+    for (size_t i = 0; i < order.size(); ++i) {
+        if (i == 0 || queries[order[i]].first != queries[order[i - 1]].first) {
+            groupStart.push_back(i);
+        }
+    }
+    groupStart.push_back(order.size());
+
+    std::vector<int> results(queries.size(), INF);
+    ParallelExecutor executor(numThreads);
+    std::vector<QueryWorkspace> workerWorkspace(executor.getThreadCount());
+
+    executor.parallelFor(groupStart.size() - 1, [&](size_t group, unsigned worker) {
+        size_t first = groupStart[group], last = groupStart[group + 1];
+        int source = queries[order[first]].first;
+
+        // A single reachable destination can stop early; several need the full tree
+        int target = queries[order[first]].second;
+        for (size_t i = first + 1; i < last; ++i) {
+            if (queries[order[i]].second != target) {
+                target = -1;
+                break;
+            }
+        }
+        if (target != -1 && findComponent(source) != findComponent(target)) return;
+
+        QueryWorkspace& workspace = workerWorkspace[worker];
+        runDistanceSearch(defaultEngine, source, target, workspace, nullptr);
+        for (size_t i = first; i < last; ++i) {
+            results[order[i]] = workspace.distanceTo(queries[order[i]].second);
+        }
+    });
+
+    return results;
+}
+
+std::vector<int> Graph::computeDistanceTable(const std::vector<int>& sources,
+                                             const std::vector<int>& targets, unsigned numThreads) const {
+    for (int source : sources) checkVertex(source);
+    for (int target : targets) checkVertex(target);
+    ensureCompacted();
+
+    const size_t targetCount = targets.size();
+    std::vector<int> table(sources.size() * targetCount, INF);
+    if (table.empty()) return table;
+
+    // Search from the smaller side; d(s, t) == d(t, s) on undirected roads
+    const bool fromTargets = targets.size() < sources.size();
+    const std::vector<int>& roots = fromTargets ? targets : sources;
+    const std::vector<int>& leaves = fromTargets ? sources : targets;
+
+    ParallelExecutor executor(numThreads);
+    std::vector<QueryWorkspace> workerWorkspace(executor.getThreadCount());
+
+    executor.parallelFor(roots.size(), [&](size_t r, unsigned worker) {
+        const int root = findComponent(roots[r]);
+        if (std::none_of(leaves.begin(), leaves.end(), [&](int leaf) { return findComponent(leaf) == root; })) {
+            return;
+        }
+
+        QueryWorkspace& workspace = workerWorkspace[worker];
+        runDistanceSearch(defaultEngine, roots[r], leaves.size() == 1 ? leaves[0] : -1, workspace, nullptr);
+
+        for (size_t k = 0; k < leaves.size(); ++k) {
+            size_t cell = fromTargets ? k * targetCount + r : r * targetCount + k;
+            table[cell] = workspace.distanceTo(leaves[k]);
+        }
+    });
+    return table;
+}
+
+std::vector<int> Graph::computeAllPairsDistances(unsigned numThreads, int blockSize) const {
+    if (blockSize <= 0) {
+        throw std::invalid_argument("Block size must be positive");
+    }
+    ensureCompacted();
+
+    // Half-range sentinel so offset + row entry never overflows in the kernels
+    const int unreachable = INF / 2;
+    const size_t n = static_cast<size_t>(numVertices);
+    std::vector<int> dist(n * n, unreachable);
+    for (int u = 0; u < numVertices; ++u) {
+        dist[u * n + u] = 0;
+        visitNeighbors(u, [&](int v, int weight) {
+            int& entry = dist[u * n + v];
+            entry = std::min(entry, std::min(weight, unreachable));
+        });
+    }
+
+    const int blocks = (numVertices + blockSize - 1) / blockSize;
+    auto blockBegin = [&](int b) { return b * blockSize; };
+    auto blockEnd = [&](int b) { return std::min(numVertices, (b + 1) * blockSize); };
+
+    // Relax tile (ib, jb) through the pivot vertices of block kb
+    auto relaxTile = [&](int ib, int jb, int kb) {
+        int jBegin = blockBegin(jb);
+        size_t width = static_cast<size_t>(blockEnd(jb) - jBegin);
+        for (int k = blockBegin(kb); k < blockEnd(kb); ++k) {
+            const int* pivotRow = &dist[k * n + jBegin];
+            for (int i = blockBegin(ib); i < blockEnd(ib); ++i) {
+                int viaPivot = dist[i * n + k];
+                if (viaPivot >= unreachable) continue;
+                SimdKernels::minPlusRow(&dist[i * n + jBegin], pivotRow, viaPivot, width);
+            }
+        }
+    };
+
+    ParallelExecutor executor(numThreads);
+    for (int kb = 0; kb < blocks; ++kb) {
+        relaxTile(kb, kb, kb);
+
+        executor.parallelFor(2 * static_cast<size_t>(blocks), [&](size_t task, unsigned) {
+            int other = static_cast<int>(task / 2);
+            if (other == kb) return;
+            if (task % 2 == 0) {
+                relaxTile(kb, other, kb);
+            } else {
+                relaxTile(other, kb, kb);
+            }
+        });
+
+        executor.parallelFor(static_cast<size_t>(blocks), [&](size_t task, unsigned) {
+            int ib = static_cast<int>(task);
+            if (ib == kb) return;
+            for (int jb = 0; jb < blocks; ++jb) {
+                if (jb != kb) relaxTile(ib, jb, kb);
+            }
+        });
+    }
+
+    for (int& entry : dist) {
+        if (entry >= unreachable) entry = INF;
+    }
+    return dist;
+}
+
+BetweennessScores Graph::computeBetweenness(unsigned numThreads) const {
+    std::vector<int> sources(numVertices);
+    std::iota(sources.begin(), sources.end(), 0);
+    // Every unordered pair is met once from each end
+    return runBrandes(sources, 0.5, numThreads);
+}
+
+BetweennessScores Graph::estimateBetweenness(int sourceBudget, unsigned numThreads, unsigned seed) const {
+    if (sourceBudget <= 0) {
+        throw std::invalid_argument("Source budget must be positive");
+    }
+    if (sourceBudget >= numVertices) {
+        return computeBetweenness(numThreads);
+    }
+
+    // Partial Fisher-Yates shuffle picks distinct sources
+    std::vector<int> sources(numVertices);
+    std::iota(sources.begin(), sources.end(), 0);
+    std::mt19937 random(seed);
+    for (int i = 0; i < sourceBudget; ++i) {
+        std::uniform_int_distribution<int> pick(i, numVertices - 1);
+        std::swap(sources[i], sources[pick(random)]);
+    }
+    sources.resize(sourceBudget);
+    return runBrandes(sources, 0.5 * numVertices / sourceBudget, numThreads);
+}
+
+BetweennessScores Graph::runBrandes(const std::vector<int>& sources, double scale, unsigned numThreads) const {
+    ensureCompacted();
+
+    // Flat arcs for both storages; each arc gets its own credit slot, and
+    // the two directions of a road are combined at the end
+    std::vector<int> offsets(numVertices + 1, 0);
+    std::vector<int> targets;
+    std::vector<int> weights;
+    for (int u = 0; u < numVertices; ++u) {
+        visitNeighbors(u, [&](int v, int weight) {
+            targets.push_back(v);
+            weights.push_back(weight);
+        });
+        offsets[u + 1] = static_cast<int>(targets.size());
+    }
+    const size_t arcs = targets.size();
+
+    // Search arrays and score accumulators owned by one worker thread
+    struct BrandesWorker {
+        std::vector<int> distance;
+        std::vector<int> position;  // Index in the settle order, -1 while open
+        std::vector<double> paths;  // Number of shortest routes from the source
+        std::vector<double> dependency;
+        std::vector<int> order;
+        std::vector<std::pair<int, int>> heap;
+        std::vector<int> skipped;   // Far ends of roads that would overflow an int route
+        std::vector<double> vertexCredit;
+        std::vector<double> arcCredit;
+    };
+
+    ParallelExecutor executor(numThreads);
+    std::vector<BrandesWorker> workers(executor.getThreadCount());
+    for (BrandesWorker& worker : workers) {
+        worker.distance.assign(numVertices, INF);
+        worker.position.assign(numVertices, -1);
+        worker.paths.assign(numVertices, 0.0);
+        worker.dependency.assign(numVertices, 0.0);
+        worker.vertexCredit.assign(numVertices, 0.0);
+        worker.arcCredit.assign(arcs, 0.0);
+    }
+
+    executor.parallelFor(sources.size(), [&](size_t index, unsigned id) {
+        BrandesWorker& w = workers[id];
+        const int source = sources[index];
+        BinaryHeapQueue queue{w.heap};
+
+        // Dijkstra in settle order. A settled neighbor v with
+        // distance[v] + weight == distance[u] is a predecessor of u; comparing
+        // positions rather than distances alone keeps zero-weight roads acyclic.
+        w.distance[source] = 0;
+        queue.push(0, source);
+        while (!queue.empty()) {
+            auto [d, u] = queue.pop();
+            if (w.position[u] != -1 || d > w.distance[u]) continue;
+            w.position[u] = static_cast<int>(w.order.size());
+            w.order.push_back(u);
+
+            double paths = u == source ? 1.0 : 0.0;
+            for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+                int v = targets[i];
+                int candidate;
+                if (w.position[v] != -1) {
+                    if (extendRoute(w.distance[v], weights[i], candidate) && candidate == d) paths += w.paths[v];
+                } else if (!extendRoute(d, weights[i], candidate)) {
+                    w.skipped.push_back(v);
+                } else if (candidate < w.distance[v]) {
+                    w.distance[v] = candidate;
+                    queue.push(candidate, v);
+                }
+            }
+            w.paths[u] = paths;
+        }
+        checkRouteLengths(w.skipped, [&](int v) { return w.distance[v]; });
+
+        // Reverse sweep: each vertex passes its dependency back to its
+        // predecessors in proportion to the routes they supply
+        for (size_t k = w.order.size(); k-- > 0;) {
+            int u = w.order[k];
+            double share = (1.0 + w.dependency[u]) / w.paths[u];
+            for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+                int v = targets[i];
+                int candidate;
+                if (w.position[v] != -1 && w.position[v] < w.position[u]
+                    && extendRoute(w.distance[v], weights[i], candidate) && candidate == w.distance[u]) {
+                    double credit = w.paths[v] * share;
+                    w.dependency[v] += credit;
+                    w.arcCredit[i] += credit;
+                }
+            }
+            if (u != source) w.vertexCredit[u] += w.dependency[u];
+        }
+
+        // Only the settled vertices were touched
+        for (int u : w.order) {
+            w.distance[u] = INF;
+            w.position[u] = -1;
+            w.paths[u] = 0.0;
+            w.dependency[u] = 0.0;
+        }
+        w.order.clear();
+        w.heap.clear();
+        w.skipped.clear();
+    });
+
+    // Reduce the per-worker credits row by row, in parallel
+    BetweennessScores scores;
+    scores.sourcesUsed = static_cast<int>(sources.size());
+    scores.vertexScores.assign(numVertices, 0.0);
+    std::vector<double> arcScores(arcs, 0.0);
+    executor.parallelFor(numVertices, [&](size_t u, unsigned) {
+        for (const BrandesWorker& worker : workers) {
+            scores.vertexScores[u] += worker.vertexCredit[u];
+            for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+                arcScores[i] += worker.arcCredit[i];
+            }
+        }
+        scores.vertexScores[u] *= scale;
+    });
+
+    for (int u = 0; u < numVertices; ++u) {
+        for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+            int v = targets[i];
+            if (v < u) continue;
+            auto first = targets.begin() + offsets[v];
+            int reverse = static_cast<int>(std::lower_bound(first, targets.begin() + offsets[v + 1], u)
+                                           - targets.begin());
+            scores.edges.push_back({u, v});
+            scores.edgeScores.push_back((arcScores[i] + arcScores[reverse]) * scale);
+        }
+    }
+    return scores;
+}
+
+void Graph::runSearch(ShortestPathEngine engine, int source, int target, std::vector<int>& distance,
+                      std::vector<int>& previous, SearchStats* stats) const {
+    ShortestPathEngine resolved = resolveEngine(engine);
+    switch (resolved) {
+        case ShortestPathEngine::BucketQueue:
+        case ShortestPathEngine::RadixHeap: {
+            ArrayLabels labels{distance, previous, {}};
+            runHeapSearch(resolved, source, target, labels, stats);
+            break;
+        }
+        case ShortestPathEngine::LinearScan:
+            runLinearScan(source, target, distance, previous.data(), stats);
+            break;
+        case ShortestPathEngine::AStarLandmarks:
+            // Goal direction only helps point-to-point queries
+            if (target != -1) {
+                runAStarLandmarks(source, target, distance, previous, stats);
+                break;
+            }
+            runBinaryHeap(source, target, distance, previous, stats);
+            break;
+        case ShortestPathEngine::Bidirectional:
+            if (target != -1) {
+                runBidirectional(source, target, distance, previous, stats);
+                break;
+            }
+            runBinaryHeap(source, target, distance, previous, stats);
+            break;
+        default:
+            runBinaryHeap(source, target, distance, previous, stats);
+            break;
+    }
+}
+
+void Graph::runBidirectional(int source, int target, std::vector<int>& distance,
+                             std::vector<int>& previous, SearchStats* stats) const {
+    distance[source] = 0;
+    if (source == target) return;
+
+    // Side 0 grows from the source, side 1 from the target (roads are undirected)
+    std::vector<int> backwardDistance(numVertices, INF);
+    std::vector<int> backwardPrevious(numVertices, -1);
+    std::vector<int>* dist[2] = {&distance, &backwardDistance};
+    std::vector<int>* prev[2] = {&previous, &backwardPrevious};
+
+    using HeapEntry = std::pair<int, int>;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heaps[2];
+    backwardDistance[target] = 0;
+    heaps[0].push({0, source});
+    heaps[1].push({0, target});
+
+    long long best = INF;
+    int meet = -1;
+    bool tooLong = false;  // some route to the target is longer than INT_MAX
+
+    while (!heaps[0].empty() && !heaps[1].empty()) {
+        // Meeting criterion: no unsettled pair of frontiers can beat best. Before
+        // any meeting, best is INT_MAX, so every remaining route is too long
+        if (static_cast<long long>(heaps[0].top().first) + heaps[1].top().first >= best) {
+            tooLong = meet == -1;
+            break;
+        }
+
+        int side = heaps[0].top().first <= heaps[1].top().first ? 0 : 1;
+        std::vector<int>& mine = *dist[side];
+        const std::vector<int>& other = *dist[1 - side];
+
+        auto [d, u] = heaps[side].top();
+        heaps[side].pop();
+        if (d > mine[u]) continue;
+        if (stats) ++stats->settledVertices;
+
+        visitNeighbors(u, [&](int v, int weight) {
+            if (stats) ++stats->relaxedEdges;
+            int candidate;
+            if (!extendRoute(d, weight, candidate)) {
+                tooLong = true;
+                return;
+            }
+            if (candidate < mine[v]) {
+                mine[v] = candidate;
+                (*prev[side])[v] = u;
+                heaps[side].push({candidate, v});
+                if (other[v] != INF && static_cast<long long>(candidate) + other[v] < best) {
+                    best = static_cast<long long>(candidate) + other[v];
+                    meet = v;
+                }
+            }
+        });
+    }
+
+    if (meet == -1) {
+        if (tooLong) throw std::overflow_error("Route length overflows int distances");
+        distance[target] = INF;
+        return;
+    }
+
+    // Splice the backward half onto the forward predecessor chain
+    for (int v = meet; v != target; v = backwardPrevious[v]) {
+        previous[backwardPrevious[v]] = v;
+    }
+    distance[target] = static_cast<int>(best);
+}
+
+void Graph::selectLandmarks(int count) {
+    if (count <= 0) {
+        throw std::invalid_argument("Landmark count must be positive");
+    }
+    count = std::min(count, numVertices);
+    ensureCompacted();
+
+    std::lock_guard<std::mutex> lock(landmarkLock.mutex);
+    landmarks.clear();
+    if (count == 0) return;
+
+    // Start from the vertex farthest from vertex 0, then repeatedly add the
+    // vertex farthest from every chosen landmark; vertices that no landmark
+    // reaches count as infinitely far, so each component gets covered
+    std::vector<int> fromZero = distancesFrom(0);
+    int next = 0;
+    for (int v = 0; v < numVertices; ++v) {
+        if (fromZero[v] != INF && fromZero[v] > fromZero[next]) next = v;
+    }
+
+    std::vector<std::vector<int>> perLandmark;
+    std::vector<int> closest(numVertices, INF);
+    std::vector<bool> chosen(numVertices, false);
+    while (true) {
+        landmarks.push_back(next);
+        chosen[next] = true;
+        perLandmark.push_back(distancesFrom(next));
+        for (int v = 0; v < numVertices; ++v) {
+            closest[v] = std::min(closest[v], perLandmark.back()[v]);
+        }
+        if (static_cast<int>(landmarks.size()) == count) break;
+
+        next = -1;
+        for (int v = 0; v < numVertices; ++v) {
+            if (!chosen[v] && (next == -1 || closest[v] > closest[next])) next = v;
+        }
+    }
+
+    const size_t landmarkCount = landmarks.size();
+    landmarkDistances.assign(static_cast<size_t>(numVertices) * landmarkCount, INF);
+    for (size_t i = 0; i < landmarkCount; ++i) {
+        for (int v = 0; v < numVertices; ++v) {
+            landmarkDistances[v * landmarkCount + i] = perLandmark[i][v];
+        }
+    }
+    landmarksDirty = false;
+}
+
+void Graph::setLandmarks(const std::vector<int>& vertices) {
+    for (int vertex : vertices) {
+        checkVertex(vertex);
+    }
+
+    std::lock_guard<std::mutex> lock(landmarkLock.mutex);
+    landmarks = vertices;
+    landmarkDistances.clear();
+    landmarksDirty = true;
+}
+
+std::vector<int> Graph::distancesFrom(int source) const {
+    std::vector<int> distance(numVertices, INF);
+    std::vector<int> previous(numVertices, -1);
+    runBinaryHeap(source, -1, distance, previous, nullptr);
+    return distance;
+}
+
+void Graph::ensureLandmarkDistances() const {
+    std::lock_guard<std::mutex> lock(landmarkLock.mutex);
+    if (landmarks.empty()) {
+        throw std::logic_error("AStarLandmarks needs landmarks; call selectLandmarks first");
+    }
+    if (!landmarksDirty) return;
+
+    const size_t landmarkCount = landmarks.size();
+    landmarkDistances.assign(static_cast<size_t>(numVertices) * landmarkCount, INF);
+    for (size_t i = 0; i < landmarkCount; ++i) {
+        std::vector<int> distance = distancesFrom(landmarks[i]);
+        for (int v = 0; v < numVertices; ++v) {
+            landmarkDistances[v * landmarkCount + i] = distance[v];
+        }
+    }
+    landmarksDirty = false;
+}
+
+void Graph::runAStarLandmarks(int source, int target, std::vector<int>& distance,
+                              std::vector<int>& previous, SearchStats* stats) const {
+    ensureLandmarkDistances();
+    const size_t landmarkCount = landmarks.size();
+    const int* toTarget = &landmarkDistances[target * landmarkCount];
+
+    // Triangle inequality: |d(L, t) - d(L, v)| <= d(v, t) for every landmark L.
+    // Different reachability from a landmark means v and t are disconnected.
+    auto lowerBound = [&](int v) {
+        const int* toVertex = &landmarkDistances[v * landmarkCount];
+        int bound = 0;
+        for (size_t i = 0; i < landmarkCount; ++i) {
+            if (toVertex[i] == INF && toTarget[i] == INF) continue;
+            if (toVertex[i] == INF || toTarget[i] == INF) return INF;
+            bound = std::max(bound, std::abs(toTarget[i] - toVertex[i]));
+        }
+        return bound;
+    };
+
+    // Heap of (estimated total, distance so far, vertex)
+    using HeapEntry = std::tuple<long long, int, int>;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+
+    distance[source] = 0;
+    int sourceBound = lowerBound(source);
+    if (sourceBound == INF) return;
+    heap.push({sourceBound, 0, source});
+
+    std::vector<int> skipped;
+    while (!heap.empty()) {
+        auto [estimate, dist, u] = heap.top();
+        heap.pop();
+        if (dist > distance[u]) continue;
+        if (stats) ++stats->settledVertices;
+        if (u == target) return;
+
+        visitNeighbors(u, [&](int v, int weight) {
+            if (stats) ++stats->relaxedEdges;
+            int candidate;
+            if (!extendRoute(dist, weight, candidate)) {
+                skipped.push_back(v);
+                return;
+            }
+            if (candidate < distance[v]) {
+                int bound = lowerBound(v);
+                if (bound == INF) return;
+                distance[v] = candidate;
+                previous[v] = u;
+                heap.push({static_cast<long long>(candidate) + bound, candidate, v});
+            }
+        });
+    }
+    checkRouteLengths(skipped, [&](int v) { return distance[v]; });
+}
+
+
+ShortestPathTree Graph::computeShortestPathTree(int source) const {
+    return computeShortestPathTree(source, defaultEngine);
+}
+
+ShortestPathTree Graph::computeShortestPathTree(int source, ShortestPathEngine engine,
+                                                SearchStats* stats) const {
+    checkVertex(source);
+    ensureCompacted();
 
     std::vector<int> distance(numVertices, INF);
     std::vector<int> previous(numVertices, -1);
-    std::vector<bool> visited(numVertices, false);
 
+    runSearch(engine, source, -1, distance, previous, stats);
+
+    return ShortestPathTree(source, std::move(distance), std::move(previous));
+}
+
+ShortestPathEngine Graph::resolveEngine(ShortestPathEngine engine) const {
+    if (engine != ShortestPathEngine::Auto) return engine;
+    if (storage == GraphStorage::Dense) return ShortestPathEngine::LinearScan;
+    // Integer weights allow monotone queues; short bucket rings are cheapest to scan
+    return maxEdgeWeight <= BUCKET_QUEUE_WEIGHT_LIMIT ? ShortestPathEngine::BucketQueue
+                                                      : ShortestPathEngine::RadixHeap;
+}
+
+bool Graph::isLabelSetting(ShortestPathEngine engine) {
+    return engine == ShortestPathEngine::BinaryHeap || engine == ShortestPathEngine::BucketQueue
+           || engine == ShortestPathEngine::RadixHeap;
+}
+
+void Graph::runLinearScan(int source, int target, std::vector<int>& distance,
+                          int* previous, SearchStats* stats) const {
     distance[source] = 0;
+    std::vector<int> skipped;  // far ends of roads that would overflow an int route
+
+    if (storage == GraphStorage::Dense) {
+        // Matrix rows are contiguous, so selection and relaxation both run
+        // as vector kernels; open[v] is -1 until v is settled
+        std::vector<int> open(numVertices, -1);
+        std::vector<int> row;
+        const size_t count = static_cast<size_t>(numVertices);
+        for (int settled = 0; settled < numVertices; ++settled) {
+            int u = SimdKernels::argMinOpen(distance.data(), open.data(), count);
+            if (u == -1) break;
+
+            open[u] = 0;
+            if (stats) ++stats->settledVertices;
+            if (u == target) return;
+
+            // The kernels add without checks; near INT_MAX, relax a copy of the
+            // row with the roads that would wrap masked out
+            const int* roads = adjacencyMatrix[u].data();
+            if (distance[u] >= INF - maxEdgeWeight) {
+                row = adjacencyMatrix[u];
+                int candidate;
+                for (int v = 0; v < numVertices; ++v) {
+                    if (row[v] != INF && !extendRoute(distance[u], row[v], candidate)) {
+                        if (stats) ++stats->relaxedEdges;
+                        row[v] = INF;
+                        skipped.push_back(v);
+                    }
+                }
+                roads = row.data();
+            }
 
-    for (int count = 0; count < numVertices - 1; ++count) {
+            // The diagonal entry is 0 and counted by the kernel; u is settled so it never updates
+            size_t edges = SimdKernels::relaxRow(distance.data(), previous, open.data(),
+                                                 roads, distance[u], u, count);
+            if (stats) stats->relaxedEdges += static_cast<int>(edges) - 1;
+        }
+        checkRouteLengths(skipped, [&](int v) { return distance[v]; });
+        return;
+    }
+
+    std::vector<bool> visited(numVertices, false);
+
+    for (int count = 0; count < numVertices; ++count) {
         // Find vertex with minimum distance value among unvisited vertices
         int minDistance = INF;
         int minIndex = -1;
@@ -53,21 +1261,80 @@ std::pair<int, std::vector<int>> Graph::findShortestPath(int source, int destina
         if (minIndex == -1) break;
 
         visited[minIndex] = true;
+        if (stats) ++stats->settledVertices;
+        if (minIndex == target) return;
 
         // Update distance values of adjacent vertices
-        for (int v = 0; v < numVertices; ++v) {
-            if (!visited[v] && 
-                adjacencyMatrix[minIndex][v] != INF && 
-                distance[minIndex] != INF &&
-                distance[minIndex] + adjacencyMatrix[minIndex][v] < distance[v]) {
-                
-                distance[v] = distance[minIndex] + adjacencyMatrix[minIndex][v];
-                previous[v] = minIndex;
+        visitNeighbors(minIndex, [&](int v, int weight) {
+            if (stats) ++stats->relaxedEdges;
+            if (visited[v]) return;
+            int candidate;
+            if (!extendRoute(distance[minIndex], weight, candidate)) {
+                skipped.push_back(v);
+                return;
             }
-        }
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                if (previous) previous[v] = minIndex;
+            }
+        });
     }
+    checkRouteLengths(skipped, [&](int v) { return distance[v]; });
+}
+
+void Graph::runBinaryHeap(int source, int target, std::vector<int>& distance,
+                          std::vector<int>& previous, SearchStats* stats) const {
+    ArrayLabels labels{distance, previous, {}};
+    runHeapSearch(ShortestPathEngine::BinaryHeap, source, target, labels, stats);
+}
 
-    // Reconstruct path
+template<typename Labels>
+void Graph::runHeapSearch(ShortestPathEngine engine, int source, int target, Labels& labels,
+                          SearchStats* stats) const {
+    if (engine == ShortestPathEngine::BucketQueue) {
+        threadBuckets.reset(maxEdgeWeight);
+        runQueueSearch(source, target, threadBuckets, labels, stats);
+    } else if (engine == ShortestPathEngine::RadixHeap) {
+        threadRadixHeap.reset();
+        runQueueSearch(source, target, threadRadixHeap, labels, stats);
+    } else {
+        BinaryHeapQueue heap{labels.heapStorage()};
+        runQueueSearch(source, target, heap, labels, stats);
+    }
+}
+
+template<typename PriorityQueue, typename Labels>
+void Graph::runQueueSearch(int source, int target, PriorityQueue& queue, Labels& labels,
+                           SearchStats* stats) const {
+    // Queue of (distance, vertex); outdated entries are skipped when popped
+    labels.update(source, 0, -1);
+    queue.push(0, source);
+
+    std::vector<int> skipped;
+    while (!queue.empty()) {
+        auto [dist, u] = queue.pop();
+        if (dist > labels.distanceTo(u)) continue;
+        if (stats) ++stats->settledVertices;
+        if (u == target) return;
+
+        visitNeighbors(u, [&](int v, int weight) {
+            if (stats) ++stats->relaxedEdges;
+            int candidate;
+            if (!extendRoute(dist, weight, candidate)) {
+                skipped.push_back(v);
+                return;
+            }
+            if (candidate < labels.distanceTo(v)) {
+                labels.update(v, candidate, u);
+                queue.push(candidate, v);
+            }
+        });
+    }
+    checkRouteLengths(skipped, [&](int v) { return labels.distanceTo(v); });
+}
+
+std::vector<int> Graph::buildPath(const std::vector<int>& previous,
+                                  const std::vector<int>& distance, int destination) {
     std::vector<int> path;
     if (distance[destination] != INF) {
         int current = destination;
@@ -77,20 +1344,49 @@ std::pair<int, std::vector<int>> Graph::findShortestPath(int source, int destina
         }
         std::reverse(path.begin(), path.end());
     }
+    return path;
+}
 
-    return {distance[destination], path};
+int Graph::getEdgeWeight(int from, int to) const {
+    checkVertex(from);
+    checkVertex(to);
+
+    if (storage == GraphStorage::Dense) {
+        return adjacencyMatrix[from][to];
+    }
+    if (from == to) return 0;
+
+    ensureCompacted();
+    int arc = findArc(from, to);
+    return arc == -1 ? INF : edgeWeights[arc];
+}
+
+int Graph::getEdgeCount() const {
+    if (storage == GraphStorage::Dense) {
+        int count = 0;
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = i + 1; j < numVertices; ++j) {
+                if (adjacencyMatrix[i][j] != INF) ++count;
+            }
+        }
+        return count;
+    }
+
+    ensureCompacted();
+    return static_cast<int>(neighbors.size() / 2);
 }
 
 void Graph::printMatrix() const {
     std::cout << "Adjacency Matrix:\n";
     for (int i = 0; i < numVertices; ++i) {
         for (int j = 0; j < numVertices; ++j) {
-            if (adjacencyMatrix[i][j] == INF) {
+            int weight = getEdgeWeight(i, j);
+            if (weight == INF) {
                 std::cout << "INF ";
             } else {
-                std::cout << adjacencyMatrix[i][j] << " ";
+                std::cout << weight << " ";
             }
         }
         std::cout << "\n";
     }
-} 
\ No newline at end of file
+}
@@ -0,0 +1,228 @@
+#include "HubLabels.h"
+#include "ContractionHierarchy.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+const char MAGIC[8] = {'R', 'C', 'H', 'U', 'B', 'L', 'B', '\0'};
+
+using HeapEntry = std::pair<int, int>;
+using MinHeap = std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>>;
+
+}  // namespace
+
+const std::uint32_t HubLabels::FORMAT_VERSION;
+const std::uint32_t HubLabels::BYTE_ORDER_MARK;
+
+HubLabels::HubLabels() : numVertices(0) {}
+
+HubLabels::HubLabels(const Graph& graph, HubOrder order) : numVertices(graph.getVertexCount()) {
+    build(graph, computeOrder(graph, order));
+}
+
+void HubLabels::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= numVertices) {
+        throw std::out_of_range("Invalid vertex index");
+    }
+}
+
+std::vector<int> HubLabels::computeOrder(const Graph& graph, HubOrder order) {
+    const int vertices = graph.getVertexCount();
+    std::vector<int> importance(vertices, 0);
+    if (order == HubOrder::ContractionHierarchy) {
+        ContractionHierarchy hierarchy(graph);
+        for (int v = 0; v < vertices; ++v) importance[v] = hierarchy.getRank(v);
+    } else {
+        for (int v = 0; v < vertices; ++v) {
+            graph.forEachNeighbor(v, [&](int, int) { ++importance[v]; });
+        }
+    }
+
+    std::vector<int> sorted(vertices);
+    for (int v = 0; v < vertices; ++v) sorted[v] = v;
+    std::stable_sort(sorted.begin(), sorted.end(), [&](int a, int b) { return importance[a] > importance[b]; });
+    return sorted;
+}
+
+void HubLabels::build(const Graph& graph, const std::vector<int>& order) {
+    std::vector<std::vector<LabelEntry>> labels(numVertices);
+    // rootLabel[hub] = distance from the current root to hub, per its label so far
+    std::vector<int> rootLabel(numVertices, INF);
+    std::vector<int> distance(numVertices, INF);
+    std::vector<int> touched;
+
+    for (int hub = 0; hub < numVertices; ++hub) {
+        const int root = order[hub];
+        for (const LabelEntry& entry : labels[root]) rootLabel[entry.hub] = entry.distance;
+
+        MinHeap heap;
+        distance[root] = 0;
+        touched.push_back(root);
+        heap.push({0, root});
+        while (!heap.empty()) {
+            auto [d, u] = heap.top();
+            heap.pop();
+            if (d > distance[u]) continue;
+
+            // Prune when an earlier hub already covers (root, u)
+            bool covered = false;
+            for (const LabelEntry& entry : labels[u]) {
+                if (rootLabel[entry.hub] != INF
+                    && static_cast<long long>(rootLabel[entry.hub]) + entry.distance <= d) {
+                    covered = true;
+                    break;
+                }
+            }
+            if (covered) continue;
+
+            labels[u].push_back({hub, d});
+            graph.forEachNeighbor(u, [&](int v, int weight) {
+                if (d + weight < distance[v]) {
+                    if (distance[v] == INF) touched.push_back(v);
+                    distance[v] = d + weight;
+                    heap.push({distance[v], v});
+                }
+            });
+        }
+
+        for (int v : touched) distance[v] = INF;
+        touched.clear();
+        for (const LabelEntry& entry : labels[root]) rootLabel[entry.hub] = INF;
+    }
+
+    // Flatten; hubs were appended in increasing order, so labels are sorted
+    std::size_t total = numVertices;
+    for (const auto& label : labels) total += label.size();
+    if (total > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::overflow_error("Hub labels exceed 32-bit offsets");
+    }
+    labelOffsets.assign(numVertices + 1, 0);
+    entries.clear();
+    entries.reserve(total);
+    for (int v = 0; v < numVertices; ++v) {
+        entries.insert(entries.end(), labels[v].begin(), labels[v].end());
+        entries.push_back({INF, INF});
+        labelOffsets[v + 1] = static_cast<std::uint32_t>(entries.size());
+        std::vector<LabelEntry>().swap(labels[v]);
+    }
+}
+
+int HubLabels::findShortestDistance(int source, int destination) const {
+    checkVertex(source);
+    checkVertex(destination);
+
+    // Both labels end in a sentinel with hub INT_MAX, so no bounds checks
+    const LabelEntry* a = entries.data() + labelOffsets[source];
+    const LabelEntry* b = entries.data() + labelOffsets[destination];
+    long long best = INF;
+    while (true) {
+        if (a->hub == b->hub) {
+            if (a->hub == INF) break;
+            best = std::min(best, static_cast<long long>(a->distance) + b->distance);
+            ++a;
+            ++b;
+        } else if (a->hub < b->hub) {
+            ++a;
+        } else {
+            ++b;
+        }
+    }
+    return static_cast<int>(best);
+}
+
+int HubLabels::crossCheck(const Graph& graph, int samples, unsigned seed) const {
+    if (graph.getVertexCount() != numVertices) {
+        throw std::invalid_argument("Graph does not match the hub labels");
+    }
+    if (numVertices == 0) return 0;
+
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> pick(0, numVertices - 1);
+    int mismatches = 0;
+    for (int i = 0; i < samples; ++i) {
+        int source = pick(random);
+        int destination = pick(random);
+        if (findShortestDistance(source, destination) != graph.findShortestPath(source, destination).first) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+void HubLabels::save(const std::string& path) const {
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.formatVersion = FORMAT_VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.vertexCount = static_cast<std::uint32_t>(numVertices);
+    header.entryCount = entries.size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Could not create hub label file " + path);
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(labelOffsets.data()), labelOffsets.size() * sizeof(std::uint32_t));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(LabelEntry));
+    if (!out) {
+        throw std::runtime_error("Failed writing hub label file " + path);
+    }
+}
+
+HubLabels HubLabels::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Could not open hub label file " + path);
+    }
+    const std::uint64_t fileSize = static_cast<std::uint64_t>(in.tellg());
+    in.seekg(0);
+
+    FileHeader header;
+    if (fileSize < sizeof(FileHeader) || !in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("Hub label file is truncated: " + path);
+    }
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0
+        || header.byteOrderMark != BYTE_ORDER_MARK || header.formatVersion != FORMAT_VERSION) {
+        throw std::runtime_error("Not a compatible hub label file: " + path);
+    }
+
+    std::uint64_t expected = sizeof(FileHeader)
+                             + (static_cast<std::uint64_t>(header.vertexCount) + 1) * sizeof(std::uint32_t)
+                             + header.entryCount * sizeof(LabelEntry);
+    if (header.vertexCount > static_cast<std::uint32_t>(std::numeric_limits<int>::max())
+        || header.entryCount > std::numeric_limits<std::uint32_t>::max()
+        || header.entryCount < header.vertexCount || expected != fileSize) {
+        throw std::runtime_error("Hub label file size does not match its header: " + path);
+    }
+
+    HubLabels labels;
+    labels.numVertices = static_cast<int>(header.vertexCount);
+    labels.labelOffsets.resize(header.vertexCount + 1);
+    labels.entries.resize(header.entryCount);
+    in.read(reinterpret_cast<char*>(labels.labelOffsets.data()), labels.labelOffsets.size() * sizeof(std::uint32_t));
+    in.read(reinterpret_cast<char*>(labels.entries.data()), labels.entries.size() * sizeof(LabelEntry));
+    if (!in) {
+        throw std::runtime_error("Failed reading hub label file " + path);
+    }
+
+    // Queries rely on every label ending in a sentinel inside the array
+    if (labels.labelOffsets[0] != 0 || labels.labelOffsets.back() != header.entryCount) {
+        throw std::runtime_error("Corrupt hub label offsets in " + path);
+    }
+    for (int v = 0; v < labels.numVertices; ++v) {
+        std::uint32_t begin = labels.labelOffsets[v], end = labels.labelOffsets[v + 1];
+        if (end <= begin || labels.entries[end - 1].hub != INF) {
+            throw std::runtime_error("Corrupt hub label offsets in " + path);
+        }
+    }
+    return labels;
+}
@@ -0,0 +1,267 @@
+#include "MappedGraph.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+const char MAGIC[8] = {'R', 'C', 'G', 'R', 'A', 'P', 'H', '\0'};
+
+}  // namespace
+
+const std::uint32_t MappedGraph::FORMAT_VERSION;
+const std::uint32_t MappedGraph::BYTE_ORDER_MARK;
+
+MappedGraph::MappedGraph(const std::string& path)
+    : mapping(nullptr), mappingSize(0),
+#ifdef _WIN32
+      fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr),
+#endif
+      numVertices(0), numArcs(0), rowOffsets(nullptr), neighbors(nullptr), edgeWeights(nullptr) {
+#ifdef _WIN32
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Could not open graph file " + path);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fileHandle, &size)) {
+        unmap();
+        throw std::runtime_error("Could not stat graph file " + path);
+    }
+    mappingSize = static_cast<std::size_t>(size.QuadPart);
+    if (mappingSize > 0) {
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle) {
+            mapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        }
+        if (!mapping) {
+            unmap();
+            throw std::runtime_error("Could not map graph file " + path);
+        }
+    }
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open graph file " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Could not stat graph file " + path);
+    }
+    mappingSize = static_cast<std::size_t>(info.st_size);
+    if (mappingSize > 0) {
+        void* address = ::mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Could not map graph file " + path);
+        }
+        mapping = address;
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+#endif
+
+    const char* bytes = static_cast<const char*>(mapping);
+    FileHeader header;
+    if (mappingSize < sizeof(FileHeader)) {
+        unmap();
+        throw std::runtime_error("Graph file is truncated: " + path);
+    }
+    std::memcpy(&header, bytes, sizeof(FileHeader));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0
+        || header.byteOrderMark != BYTE_ORDER_MARK || header.formatVersion != FORMAT_VERSION) {
+        unmap();
+        throw std::runtime_error("Not a compatible binary graph file: " + path);
+    }
+
+    std::uint64_t expected = sizeof(FileHeader)
+                             + (static_cast<std::uint64_t>(header.vertexCount) + 1) * sizeof(std::int32_t)
+                             + header.arcCount * 2 * sizeof(std::int32_t);
+    if (header.vertexCount > static_cast<std::uint32_t>(std::numeric_limits<int>::max())
+        || header.arcCount > static_cast<std::uint64_t>(std::numeric_limits<int>::max())
+        || expected != mappingSize) {
+        unmap();
+        throw std::runtime_error("Graph file size does not match its header: " + path);
+    }
+
+    numVertices = static_cast<int>(header.vertexCount);
+    numArcs = static_cast<int>(header.arcCount);
+    rowOffsets = reinterpret_cast<const std::int32_t*>(bytes + sizeof(FileHeader));
+    neighbors = rowOffsets + numVertices + 1;
+    edgeWeights = neighbors + numArcs;
+
+    // Searches index straight into the mapping, so a well-sized file with
+    // bad offsets or neighbor ids must not get past this point
+    bool valid = rowOffsets[0] == 0 && rowOffsets[numVertices] == numArcs;
+    for (int v = 0; valid && v < numVertices; ++v) {
+        valid = rowOffsets[v] <= rowOffsets[v + 1];
+    }
+    for (int i = 0; valid && i < numArcs; ++i) {
+        valid = neighbors[i] >= 0 && neighbors[i] < numVertices;
+    }
+    if (!valid) {
+        unmap();
+        throw std::runtime_error("Corrupt graph offsets or neighbors in " + path);
+    }
+}
+
+MappedGraph::~MappedGraph() {
+    unmap();
+}
+
+void MappedGraph::unmap() {
+#ifdef _WIN32
+    if (mapping) UnmapViewOfFile(mapping);
+    if (mappingHandle) CloseHandle(mappingHandle);
+    if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (mapping) ::munmap(const_cast<void*>(mapping), mappingSize);
+#endif
+    mapping = nullptr;
+    mappingSize = 0;
+}
+
+void MappedGraph::write(const Graph& graph, const std::string& path) {
+    const int vertices = graph.getVertexCount();
+    std::vector<std::int32_t> offsets(vertices + 1, 0);
+    std::vector<std::int32_t> targets;
+    std::vector<std::int32_t> weights;
+    for (int u = 0; u < vertices; ++u) {
+        graph.forEachNeighbor(u, [&](int v, int weight) {
+            targets.push_back(v);
+            weights.push_back(weight);
+        });
+        offsets[u + 1] = static_cast<std::int32_t>(targets.size());
+    }
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.formatVersion = FORMAT_VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.vertexCount = static_cast<std::uint32_t>(vertices);
+    header.arcCount = targets.size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Could not create graph file " + path);
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(std::int32_t));
+    out.write(reinterpret_cast<const char*>(targets.data()), targets.size() * sizeof(std::int32_t));
+    out.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(std::int32_t));
+    if (!out) {
+        throw std::runtime_error("Failed writing graph file " + path);
+    }
+}
+
+void MappedGraph::convertText(const std::string& textPath, const std::string& binaryPath) {
+    std::ifstream in(textPath);
+    if (!in) {
+        throw std::runtime_error("Could not open text graph " + textPath);
+    }
+
+    int numCities = 0, numRoutes = 0;
+    if (!(in >> numCities >> numRoutes) || numCities <= 0 || numRoutes < 0) {
+        throw std::runtime_error("Invalid cities or routes count in " + textPath);
+    }
+
+    std::vector<Graph::Edge> routes;
+    routes.reserve(numRoutes);
+    for (int j = 0; j < numRoutes; ++j) {
+        int city1, city2, distance;
+        if (!(in >> city1 >> city2 >> distance) || city1 < 0 || city1 >= numCities
+            || city2 < 0 || city2 >= numCities || distance <= 0) {
+            throw std::runtime_error("Invalid route " + std::to_string(j + 1) + " in " + textPath);
+        }
+        routes.push_back({city1, city2, distance});
+    }
+
+    write(Graph::fromEdges(numCities, routes), binaryPath);
+}
+
+void MappedGraph::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= numVertices) {
+        throw std::out_of_range("Invalid vertex index");
+    }
+}
+
+int MappedGraph::getEdgeWeight(int from, int to) const {
+    checkVertex(from);
+    checkVertex(to);
+    if (from == to) return 0;
+    const std::int32_t* first = neighbors + rowOffsets[from];
+    const std::int32_t* last = neighbors + rowOffsets[from + 1];
+    const std::int32_t* it = std::lower_bound(first, last, to);
+    if (it == last || *it != to) return INF;
+    return edgeWeights[it - neighbors];
+}
+
+void MappedGraph::runDijkstra(int source, int target, std::vector<int>& distance,
+                              std::vector<int>& previous) const {
+    using HeapEntry = std::pair<int, int>;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+    distance[source] = 0;
+    heap.push({0, source});
+
+    while (!heap.empty()) {
+        auto [dist, u] = heap.top();
+        heap.pop();
+        if (dist > distance[u]) continue;
+        if (u == target) break;
+
+        for (std::int32_t i = rowOffsets[u]; i < rowOffsets[u + 1]; ++i) {
+            int v = neighbors[i];
+            int candidate = dist + edgeWeights[i];
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                previous[v] = u;
+                heap.push({candidate, v});
+            }
+        }
+    }
+}
+
+std::pair<int, std::vector<int>> MappedGraph::findShortestPath(int source, int destination) const {
+    checkVertex(source);
+    checkVertex(destination);
+    std::vector<int> distance(numVertices, INF);
+    std::vector<int> previous(numVertices, -1);
+    runDijkstra(source, destination, distance, previous);
+
+    std::vector<int> path;
+    if (distance[destination] != INF) {
+        for (int current = destination; current != -1; current = previous[current]) {
+            path.push_back(current);
+        }
+        std::reverse(path.begin(), path.end());
+    }
+    return {distance[destination], path};
+}
+
+ShortestPathTree MappedGraph::computeShortestPathTree(int source) const {
+    checkVertex(source);
+    std::vector<int> distance(numVertices, INF);
+    std::vector<int> previous(numVertices, -1);
+    runDijkstra(source, -1, distance, previous);
+    return ShortestPathTree(source, std::move(distance), std::move(previous));
+}
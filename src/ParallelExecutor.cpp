@@ -0,0 +1,78 @@
+#include "ParallelExecutor.h"
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+ParallelExecutor::ParallelExecutor(unsigned threads) : threadCount(threads) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+}
+
+void ParallelExecutor::parallelFor(size_t count,
+                                   const std::function<void(size_t, unsigned)>& body) const {
+    if (count == 0) return;
+
+    std::atomic<size_t> nextIndex(0);
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    auto work = [&](unsigned worker) {
+        try {
+            for (size_t i = nextIndex++; i < count; i = nextIndex++) {
+                body(i, worker);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError) firstError = std::current_exception();
+            nextIndex = count;
+        }
+    };
+
+    unsigned active = threadCount;
+    if (count < active) active = static_cast<unsigned>(count);
+
+    // The calling thread acts as worker 0
+    std::vector<std::thread> workers;
+    workers.reserve(active - 1);
+    for (unsigned worker = 1; worker < active; ++worker) {
+        workers.emplace_back(work, worker);
+    }
+    work(0);
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+
+    if (firstError) std::rethrow_exception(firstError);
+}
+
+void ParallelExecutor::parallelRegion(const std::function<void(unsigned)>& body) const {
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    auto work = [&](unsigned worker) {
+        try {
+            body(worker);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError) firstError = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (unsigned worker = 1; worker < threadCount; ++worker) {
+        workers.emplace_back(work, worker);
+    }
+    work(0);
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+
+    if (firstError) std::rethrow_exception(firstError);
+}
@@ -0,0 +1,34 @@
+#include "QueryWorkspace.h"
+#include <algorithm>
+
+// Define the static constant
+const int QueryWorkspace::UNREACHED;
+
+QueryWorkspace::QueryWorkspace() : epoch(0) {}
+
+void QueryWorkspace::reset(int vertices) {
+    heap.clear();
+    if (static_cast<int>(distance.size()) != vertices) {
+        distance.assign(vertices, UNREACHED);
+        previous.assign(vertices, -1);
+        stamp.assign(vertices, 0);
+        epoch = 0;
+    }
+
+    // Epoch 0 is what fresh stamps hold, so after wrapping clear them once
+    if (++epoch == 0) {
+        std::fill(stamp.begin(), stamp.end(), 0u);
+        epoch = 1;
+    }
+}
+
+std::vector<int> QueryWorkspace::pathTo(int destination) const {
+    std::vector<int> path;
+    if (distanceTo(destination) == UNREACHED) return path;
+
+    for (int current = destination; current != -1; current = predecessorOf(current)) {
+        path.push_back(current);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
@@ -0,0 +1,71 @@
+#include "RadixHeap.h"
+#include <stdexcept>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Define the static constant
+const int RadixHeap::BUCKETS;
+
+RadixHeap::RadixHeap() : last(0), count(0) {}
+
+int RadixHeap::bucketOf(unsigned key, unsigned reference) {
+    // Position of the highest differing bit, plus one
+    unsigned difference = key ^ reference;
+    if (difference == 0) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    return 32 - __builtin_clz(difference);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, difference);
+    return static_cast<int>(index) + 1;
+#else
+    int bucket = 0;
+    for (; difference; difference >>= 1) ++bucket;
+    return bucket;
+#endif
+}
+
+void RadixHeap::reset() {
+    for (auto& bucket : buckets) {
+        bucket.clear();
+    }
+    last = 0;
+    count = 0;
+}
+
+void RadixHeap::push(int key, int vertex) {
+    unsigned value = static_cast<unsigned>(key);
+    buckets[bucketOf(value, last)].push_back({value, vertex});
+    ++count;
+}
+
+std::pair<int, int> RadixHeap::pop() {
+    if (count == 0) {
+        throw std::underflow_error("Radix heap is empty");
+    }
+
+    if (buckets[0].empty()) {
+        int first = 1;
+        while (buckets[first].empty()) ++first;
+
+        // Every key in this bucket shares the bits above the differing one,
+        // so relative to their minimum they all land in lower buckets
+        std::vector<std::pair<unsigned, int>>& source = buckets[first];
+        unsigned minimum = source.front().first;
+        for (const auto& entry : source) {
+            if (entry.first < minimum) minimum = entry.first;
+        }
+        last = minimum;
+        for (const auto& entry : source) {
+            buckets[bucketOf(entry.first, last)].push_back(entry);
+        }
+        source.clear();
+    }
+
+    std::pair<unsigned, int> entry = buckets[0].back();
+    buckets[0].pop_back();
+    --count;
+    return {static_cast<int>(entry.first), entry.second};
+}
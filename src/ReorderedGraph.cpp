@@ -0,0 +1,141 @@
+#include "ReorderedGraph.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Breadth-first search that records discovery order
+ * @return The last vertex discovered (one of the farthest from root)
+ */
+int breadthFirst(const Graph& graph, int root, const std::vector<int>& degree, bool byDegree,
+                 std::vector<char>& seen, std::vector<int>& order) {
+    size_t head = order.size();
+    seen[root] = 1;
+    order.push_back(root);
+    std::vector<int> discovered;
+    while (head < order.size()) {
+        int u = order[head++];
+        discovered.clear();
+        graph.forEachNeighbor(u, [&](int v, int) {
+            if (!seen[v]) {
+                seen[v] = 1;
+                discovered.push_back(v);
+            }
+        });
+        if (byDegree) {
+            std::sort(discovered.begin(), discovered.end(), [&](int a, int b) {
+                return degree[a] != degree[b] ? degree[a] < degree[b] : a < b;
+            });
+        }
+        order.insert(order.end(), discovered.begin(), discovered.end());
+    }
+    return order.back();
+}
+
+}  // namespace
+
+std::vector<int> ReorderedGraph::computeOrder(const Graph& source, VertexOrder order) {
+    const int n = source.getVertexCount();
+    std::vector<int> degree(n, 0);
+    for (int u = 0; u < n; ++u) {
+        source.forEachNeighbor(u, [&](int, int) { ++degree[u]; });
+    }
+
+    std::vector<char> seen(n, 0);
+    std::vector<int> sequence;
+    sequence.reserve(n);
+
+    for (int start = 0; start < n; ++start) {
+        if (seen[start]) continue;
+        if (order == VertexOrder::BreadthFirst) {
+            breadthFirst(source, start, degree, false, seen, sequence);
+            continue;
+        }
+
+        // Pseudo-peripheral root: the last vertex reached by a BFS from any
+        // vertex of the component lies near its edge, which narrows the
+        // resulting band
+        size_t componentStart = sequence.size();
+        int root = breadthFirst(source, start, degree, false, seen, sequence);
+        for (size_t i = componentStart; i < sequence.size(); ++i) seen[sequence[i]] = 0;
+        sequence.resize(componentStart);
+        breadthFirst(source, root, degree, true, seen, sequence);
+        std::reverse(sequence.begin() + componentStart, sequence.end());
+    }
+    return sequence;
+}
+
+ReorderedGraph::ReorderedGraph(const Graph& source, VertexOrder order)
+    : graph(0), internalToOriginal(computeOrder(source, order)) {
+    const int n = source.getVertexCount();
+    originalToInternal.assign(n, -1);
+    for (int internal = 0; internal < n; ++internal) {
+        originalToInternal[internalToOriginal[internal]] = internal;
+    }
+
+    std::vector<Graph::Edge> edges;
+    edges.reserve(source.getEdgeCount());
+    for (int u = 0; u < n; ++u) {
+        source.forEachNeighbor(u, [&](int v, int weight) {
+            if (u < v) edges.push_back({originalToInternal[u], originalToInternal[v], weight});
+        });
+    }
+    graph = Graph::fromEdges(n, edges, source.getStorage(), source.getShortestPathEngine());
+}
+
+void ReorderedGraph::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= static_cast<int>(originalToInternal.size())) {
+        throw std::out_of_range("Invalid vertex index");
+    }
+}
+
+int ReorderedGraph::toInternal(int original) const {
+    checkVertex(original);
+    return originalToInternal[original];
+}
+
+int ReorderedGraph::toOriginal(int internal) const {
+    checkVertex(internal);
+    return internalToOriginal[internal];
+}
+
+std::pair<int, std::vector<int>> ReorderedGraph::findShortestPath(int source, int destination,
+                                                                  ShortestPathEngine engine) const {
+    auto result = graph.findShortestPath(toInternal(source), toInternal(destination), engine);
+    for (int& vertex : result.second) {
+        vertex = internalToOriginal[vertex];
+    }
+    return result;
+}
+
+ShortestPathTree ReorderedGraph::computeShortestPathTree(int source) const {
+    ShortestPathTree tree = graph.computeShortestPathTree(toInternal(source));
+    const std::vector<int>& internalDistance = tree.getDistances();
+    const std::vector<int>& internalPrevious = tree.getPredecessors();
+
+    const int n = static_cast<int>(internalToOriginal.size());
+    std::vector<int> distance(n);
+    std::vector<int> previous(n);
+    for (int internal = 0; internal < n; ++internal) {
+        int original = internalToOriginal[internal];
+        int parent = internalPrevious[internal];
+        distance[original] = internalDistance[internal];
+        previous[original] = parent == -1 ? -1 : internalToOriginal[parent];
+    }
+    return ShortestPathTree(source, std::move(distance), std::move(previous));
+}
+
+double ReorderedGraph::averageNeighborGap(const Graph& graph) {
+    long long total = 0;
+    long long arcs = 0;
+    for (int u = 0; u < graph.getVertexCount(); ++u) {
+        graph.forEachNeighbor(u, [&](int v, int) {
+            total += std::abs(u - v);
+            ++arcs;
+        });
+    }
+    return arcs == 0 ? 0.0 : static_cast<double>(total) / arcs;
+}
@@ -0,0 +1,44 @@
+#include "ShortestPathTree.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+ShortestPathTree::ShortestPathTree(int sourceVertex, std::vector<int> distances,
+                                   std::vector<int> predecessors)
+    : source(sourceVertex), distance(std::move(distances)), previous(std::move(predecessors)) {
+    if (distance.size() != previous.size()) {
+        throw std::invalid_argument("Distance and predecessor arrays must have the same size");
+    }
+}
+
+void ShortestPathTree::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= getVertexCount()) {
+        throw std::out_of_range("Invalid vertex index");
+    }
+}
+
+int ShortestPathTree::distanceTo(int destination) const {
+    checkVertex(destination);
+    return distance[destination];
+}
+
+bool ShortestPathTree::hasPathTo(int destination) const {
+    checkVertex(destination);
+    return distance[destination] != std::numeric_limits<int>::max();
+}
+
+int ShortestPathTree::predecessorOf(int vertex) const {
+    checkVertex(vertex);
+    return previous[vertex];
+}
+
+std::vector<int> ShortestPathTree::pathTo(int destination) const {
+    std::vector<int> path;
+    if (!hasPathTo(destination)) return path;
+
+    for (int current = destination; current != -1; current = previous[current]) {
+        path.push_back(current);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
@@ -0,0 +1,351 @@
+#include "SimdKernels.h"
+#include <climits>
+#include <stdexcept>
+
+// MSVC does not define __SSE2__, but every x64 target supports it
+#if defined(__SSE2__) || defined(_M_X64)
+#define ROADFLOW_HAS_SSE2 1
+#include <immintrin.h>
+#endif
+
+// AVX2 variants are compiled for a specific target and only called after
+// the CPU has been checked, so the rest of the build keeps its baseline flags
+#if defined(ROADFLOW_HAS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define ROADFLOW_HAS_AVX2 1
+#define ROADFLOW_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(ROADFLOW_HAS_SSE2) && defined(_MSC_VER)
+#define ROADFLOW_HAS_AVX2 1
+#define ROADFLOW_AVX2_TARGET
+#include <intrin.h>
+#endif
+
+namespace {
+
+const int INF = INT_MAX;
+
+int lowestBit(unsigned mask) {
+    int index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+}
+
+// ---- Scalar ---------------------------------------------------------------
+
+void minPlusRowScalar(int* dst, const int* src, int offset, size_t count) {
+    for (size_t j = 0; j < count; ++j) {
+        int candidate = offset + src[j];
+        dst[j] = candidate < dst[j] ? candidate : dst[j];
+    }
+}
+
+// Settled lanes read as INF without a branch on the open mask
+inline int openKey(int distance, int open) {
+    return (distance & open) | (INF & ~open);
+}
+
+int findKey(const int* distance, const int* open, size_t from, size_t count, int key) {
+    for (size_t j = from; j < count; ++j) {
+        if (openKey(distance[j], open[j]) == key) return static_cast<int>(j);
+    }
+    return -1;
+}
+
+int argMinOpenScalar(const int* distance, const int* open, size_t count) {
+    int best = INF;
+    for (size_t j = 0; j < count; ++j) {
+        int key = openKey(distance[j], open[j]);
+        best = key < best ? key : best;
+    }
+    return best == INF ? -1 : findKey(distance, open, 0, count, best);
+}
+
+template<bool TrackPrevious>
+size_t relaxRowScalar(int* distance, int* previous, const int* open, const int* row,
+                      int base, int parent, size_t count) {
+    size_t edges = 0;
+    for (size_t j = 0; j < count; ++j) {
+        int valid = -static_cast<int>(row[j] != INF);
+        int candidate = base + (row[j] & valid);
+        int better = valid & open[j] & -static_cast<int>(candidate < distance[j]);
+        distance[j] = (candidate & better) | (distance[j] & ~better);
+        if (TrackPrevious) previous[j] = (parent & better) | (previous[j] & ~better);
+        edges += valid & 1;
+    }
+    return edges;
+}
+
+// ---- SSE2 / SSE4.1 --------------------------------------------------------
+
+#if defined(ROADFLOW_HAS_SSE2)
+
+#if defined(__SSE4_1__)
+inline __m128i min_epi32(__m128i a, __m128i b) {
+    return _mm_min_epi32(a, b);
+}
+#else
+// SSE2 has no packed 32-bit min; blend through a compare mask instead
+inline __m128i min_epi32(__m128i a, __m128i b) {
+    __m128i aGreater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+}
+#endif
+
+inline __m128i select128(__m128i mask, __m128i ifSet, __m128i ifClear) {
+    return _mm_or_si128(_mm_and_si128(mask, ifSet), _mm_andnot_si128(mask, ifClear));
+}
+
+void minPlusRowSse(int* dst, const int* src, int offset, size_t count) {
+    size_t j = 0;
+    const __m128i add = _mm_set1_epi32(offset);
+    for (; j + 4 <= count; j += 4) {
+        __m128i candidate = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + j)), add);
+        __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + j));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j), min_epi32(current, candidate));
+    }
+    minPlusRowScalar(dst + j, src + j, offset, count - j);
+}
+
+int argMinOpenSse(const int* distance, const int* open, size_t count) {
+    const __m128i inf = _mm_set1_epi32(INF);
+    __m128i best = inf;
+    size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(distance + j));
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(open + j));
+        best = min_epi32(best, select128(o, d, inf));
+    }
+    best = min_epi32(best, _mm_shuffle_epi32(best, _MM_SHUFFLE(1, 0, 3, 2)));
+    best = min_epi32(best, _mm_shuffle_epi32(best, _MM_SHUFFLE(2, 3, 0, 1)));
+    int minimum = _mm_cvtsi128_si32(best);
+    for (size_t k = j; k < count; ++k) {
+        int key = openKey(distance[k], open[k]);
+        minimum = key < minimum ? key : minimum;
+    }
+    if (minimum == INF) return -1;
+
+    const __m128i target = _mm_set1_epi32(minimum);
+    for (j = 0; j + 4 <= count; j += 4) {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(distance + j));
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(open + j));
+        unsigned mask = static_cast<unsigned>(
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(select128(o, d, inf), target))));
+        if (mask) return static_cast<int>(j) + lowestBit(mask);
+    }
+    return findKey(distance, open, j, count, minimum);
+}
+
+template<bool TrackPrevious>
+size_t relaxRowSse(int* distance, int* previous, const int* open, const int* row,
+                   int base, int parent, size_t count) {
+    const __m128i inf = _mm_set1_epi32(INF);
+    const __m128i baseVector = _mm_set1_epi32(base);
+    const __m128i parentVector = _mm_set1_epi32(parent);
+    // Missing lanes compare to -1, so subtracting the mask counts present entries
+    __m128i present = _mm_setzero_si128();
+    size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + j));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(distance + j));
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(open + j));
+        __m128i missing = _mm_cmpeq_epi32(w, inf);
+        __m128i candidate = _mm_add_epi32(baseVector, w);
+        __m128i better = _mm_andnot_si128(missing, _mm_and_si128(o, _mm_cmpgt_epi32(d, candidate)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(distance + j), select128(better, candidate, d));
+        if (TrackPrevious) {
+            __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + j));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(previous + j), select128(better, parentVector, p));
+        }
+        present = _mm_sub_epi32(present, _mm_xor_si128(missing, _mm_set1_epi32(-1)));
+    }
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), present);
+    size_t edges = static_cast<size_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+    // previous is null for distance-only searches; offsetting it would be undefined
+    return edges + relaxRowScalar<TrackPrevious>(distance + j, TrackPrevious ? previous + j : nullptr,
+                                                 open + j, row + j, base, parent, count - j);
+}
+
+#endif  // ROADFLOW_HAS_SSE2
+
+// ---- AVX2 -----------------------------------------------------------------
+
+#if defined(ROADFLOW_HAS_AVX2)
+
+ROADFLOW_AVX2_TARGET
+void minPlusRowAvx2(int* dst, const int* src, int offset, size_t count) {
+    size_t j = 0;
+    const __m256i add = _mm256_set1_epi32(offset);
+    for (; j + 8 <= count; j += 8) {
+        __m256i candidate = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + j)), add);
+        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + j));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + j), _mm256_min_epi32(current, candidate));
+    }
+    minPlusRowScalar(dst + j, src + j, offset, count - j);
+}
+
+ROADFLOW_AVX2_TARGET
+int argMinOpenAvx2(const int* distance, const int* open, size_t count) {
+    const __m256i inf = _mm256_set1_epi32(INF);
+    __m256i best = inf;
+    size_t j = 0;
+    for (; j + 8 <= count; j += 8) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(distance + j));
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(open + j));
+        best = _mm256_min_epi32(best, _mm256_blendv_epi8(inf, d, o));
+    }
+    __m128i half = _mm_min_epi32(_mm256_castsi256_si128(best), _mm256_extracti128_si256(best, 1));
+    half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+    half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+    int minimum = _mm_cvtsi128_si32(half);
+    for (size_t k = j; k < count; ++k) {
+        int key = openKey(distance[k], open[k]);
+        minimum = key < minimum ? key : minimum;
+    }
+    if (minimum == INF) return -1;
+
+    const __m256i target = _mm256_set1_epi32(minimum);
+    for (j = 0; j + 8 <= count; j += 8) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(distance + j));
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(open + j));
+        __m256i hit = _mm256_cmpeq_epi32(_mm256_blendv_epi8(inf, d, o), target);
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(hit)));
+        if (mask) return static_cast<int>(j) + lowestBit(mask);
+    }
+    return findKey(distance, open, j, count, minimum);
+}
+
+template<bool TrackPrevious>
+ROADFLOW_AVX2_TARGET
+size_t relaxRowAvx2(int* distance, int* previous, const int* open, const int* row,
+                    int base, int parent, size_t count) {
+    const __m256i inf = _mm256_set1_epi32(INF);
+    const __m256i baseVector = _mm256_set1_epi32(base);
+    const __m256i parentVector = _mm256_set1_epi32(parent);
+    __m256i present = _mm256_setzero_si256();
+    size_t j = 0;
+    for (; j + 8 <= count; j += 8) {
+        __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(distance + j));
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(open + j));
+        __m256i missing = _mm256_cmpeq_epi32(w, inf);
+        __m256i candidate = _mm256_add_epi32(baseVector, w);
+        __m256i better = _mm256_andnot_si256(missing, _mm256_and_si256(o, _mm256_cmpgt_epi32(d, candidate)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(distance + j), _mm256_blendv_epi8(d, candidate, better));
+        if (TrackPrevious) {
+            __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(previous + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(previous + j), _mm256_blendv_epi8(p, parentVector, better));
+        }
+        present = _mm256_sub_epi32(present, _mm256_xor_si256(missing, _mm256_set1_epi32(-1)));
+    }
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), present);
+    size_t edges = 0;
+    for (int lane : lanes) edges += static_cast<size_t>(lane);
+    // previous is null for distance-only searches; offsetting it would be undefined
+    return edges + relaxRowScalar<TrackPrevious>(distance + j, TrackPrevious ? previous + j : nullptr,
+                                                 open + j, row + j, base, parent, count - j);
+}
+
+bool cpuHasAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    // AVX2 also needs the OS to save YMM registers (OSXSAVE + XCR0 bits 1, 2)
+    bool osSavesYmm = (info[2] & (1 << 27)) && ((_xgetbv(0) & 0x6) == 0x6);
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif  // ROADFLOW_HAS_AVX2
+
+SimdKernels::Level& activeLevel() {
+    static SimdKernels::Level level = SimdKernels::bestSupportedLevel();
+    return level;
+}
+
+}  // namespace
+
+SimdKernels::Level SimdKernels::bestSupportedLevel() {
+#if defined(ROADFLOW_HAS_AVX2)
+    if (cpuHasAvx2()) return Level::AVX2;
+#endif
+#if defined(ROADFLOW_HAS_SSE2)
+    return Level::SSE;
+#else
+    return Level::Scalar;
+#endif
+}
+
+void SimdKernels::setLevel(Level level) {
+    if (static_cast<int>(level) > static_cast<int>(bestSupportedLevel())) {
+        throw std::invalid_argument("Kernel level not supported by this build or CPU");
+    }
+    activeLevel() = level;
+}
+
+SimdKernels::Level SimdKernels::getLevel() {
+    return activeLevel();
+}
+
+void SimdKernels::minPlusRow(int* dst, const int* src, int offset, size_t count) {
+    switch (activeLevel()) {
+#if defined(ROADFLOW_HAS_AVX2)
+        case Level::AVX2: minPlusRowAvx2(dst, src, offset, count); return;
+#endif
+#if defined(ROADFLOW_HAS_SSE2)
+        case Level::SSE: minPlusRowSse(dst, src, offset, count); return;
+#endif
+        default: minPlusRowScalar(dst, src, offset, count); return;
+    }
+}
+
+int SimdKernels::argMinOpen(const int* distance, const int* open, size_t count) {
+    switch (activeLevel()) {
+#if defined(ROADFLOW_HAS_AVX2)
+        case Level::AVX2: return argMinOpenAvx2(distance, open, count);
+#endif
+#if defined(ROADFLOW_HAS_SSE2)
+        case Level::SSE: return argMinOpenSse(distance, open, count);
+#endif
+        default: return argMinOpenScalar(distance, open, count);
+    }
+}
+
+size_t SimdKernels::relaxRow(int* distance, int* previous, const int* open, const int* row,
+                             int base, int parent, size_t count) {
+    switch (activeLevel()) {
+#if defined(ROADFLOW_HAS_AVX2)
+        case Level::AVX2:
+            return previous ? relaxRowAvx2<true>(distance, previous, open, row, base, parent, count)
+                            : relaxRowAvx2<false>(distance, previous, open, row, base, parent, count);
+#endif
+#if defined(ROADFLOW_HAS_SSE2)
+        case Level::SSE:
+            return previous ? relaxRowSse<true>(distance, previous, open, row, base, parent, count)
+                            : relaxRowSse<false>(distance, previous, open, row, base, parent, count);
+#endif
+        default:
+            return previous ? relaxRowScalar<true>(distance, previous, open, row, base, parent, count)
+                            : relaxRowScalar<false>(distance, previous, open, row, base, parent, count);
+    }
+}
+
+const char* SimdKernels::instructionSet() {
+    switch (activeLevel()) {
+        case Level::AVX2: return "AVX2";
+#if defined(__SSE4_1__)
+        case Level::SSE: return "SSE4.1";
+#else
+        case Level::SSE: return "SSE2";
+#endif
+        default: return "scalar";
+    }
+}
@@ -110,13 +110,13 @@ bool loadPrioritySchedulingFromFile(const std::string& filename, RoadScheduler&
             return false;
         }
         
-        auto result = graph.findShortestPath(startCity, endCity);
-        int shortestDistance = result.first;
-        
-        if (shortestDistance == std::numeric_limits<int>::max()) {
+        // Reject disconnected endpoints without running a search
+        if (!graph.isConnected(startCity, endCity)) {
             std::cout << "Error: No path exists for road " << (i + 1) << "\n";
             return false;
         }
+
+        int shortestDistance = graph.findShortestDistance(startCity, endCity);
         
         // Read road parameters
         Road road;
@@ -279,8 +279,7 @@ void runPriorityScheduling() {
             return;
         }
         
-        auto result = graph.findShortestPath(startCity, endCity);
-        int shortestDistance = result.first;
+        int shortestDistance = graph.findShortestDistance(startCity, endCity);
         
         if (shortestDistance == std::numeric_limits<int>::max()) {
             std::cout << "No path exists between the specified cities!\n";
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "CompactGraph.h"
+#include "test_helpers.h"
+#include <cstdlib>
+
+namespace {
+
+template<typename Compact>
+void expectSameDistances(const Graph& graph, const Compact& compact) {
+    ASSERT_EQ(static_cast<int>(compact.getVertexCount()), graph.getVertexCount());
+    EXPECT_EQ(compact.getEdgeCount(), static_cast<size_t>(graph.getEdgeCount()));
+    for (int source = 0; source < graph.getVertexCount(); source += 17) {
+        std::vector<int> expected = graph.computeShortestPathTree(source).getDistances();
+        auto actual = compact.distancesFrom(source);
+        for (int v = 0; v < graph.getVertexCount(); ++v) {
+            if (expected[v] == std::numeric_limits<int>::max()) {
+                ASSERT_EQ(actual[v], Compact::UNREACHABLE);
+            } else {
+                ASSERT_EQ(static_cast<long long>(actual[v]), expected[v]);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(CompactGraphTest, EveryInstantiationMatchesGraph) {
+    Graph g = makeRandomNetwork(200, 700, 1000, 5);
+    expectSameDistances(g, CompactGraph<std::uint16_t, std::uint32_t, std::uint32_t>::fromGraph(g));
+    expectSameDistances(g, CompactGraph<std::uint16_t, std::uint32_t, std::uint64_t>::fromGraph(g));
+    expectSameDistances(g, CompactGraph<std::uint32_t, std::uint32_t, std::uint64_t>::fromGraph(g));
+    expectSameDistances(g, CompactGraph<int, int, int>::fromGraph(g));
+    expectSameDistances(g, CompactGraph<int, int, long long>::fromGraph(g));
+}
+
+TEST(CompactGraphTest, PathsAndEdgeWeights) {
+    CompactRoadGraph network(5, {{0, 1, 7}, {1, 2, 7}, {0, 2, 20}, {0, 2, 15}, {3, 3, 1}});
+    EXPECT_EQ(network.getEdgeCount(), 2u + 1u);
+    EXPECT_EQ(network.getEdgeWeight(2, 0), 15u);
+    EXPECT_EQ(network.getEdgeWeight(3, 3), 0u);
+    EXPECT_EQ(network.getEdgeWeight(0, 4), CompactRoadGraph::UNREACHABLE);
+
+    auto route = network.findShortestPath(0, 2);
+    EXPECT_EQ(route.first, 14u);
+    EXPECT_EQ(route.second, std::vector<std::uint32_t>({0, 1, 2}));
+    EXPECT_TRUE(network.findShortestPath(0, 4).second.empty());
+    EXPECT_THROW(network.findShortestPath(0, 5), std::out_of_range);
+}
+
+TEST(CompactGraphTest, WideAccumulatorAvoidsOverflow) {
+    const int big = std::numeric_limits<int>::max() / 2 + 10;
+    Graph g(3);
+    g.addEdge(0, 1, big);
+    g.addEdge(1, 2, big);
+
+    auto wide = CompactGraph<int, int, long long>::fromGraph(g);
+    EXPECT_EQ(wide.findShortestPath(0, 2).first, 2LL * big);
+
+    auto narrow = CompactGraph<int, int, int>::fromGraph(g);
+    EXPECT_THROW(narrow.findShortestPath(0, 2), std::overflow_error);
+
+    // A road that overflows toward one city does not spoil routes to others
+    Graph branch(4);
+    branch.addEdge(0, 1, 10);
+    branch.addEdge(1, 2, std::numeric_limits<int>::max() - 5);
+    branch.addEdge(0, 3, 20);
+    auto branchNarrow = CompactGraph<int, int, int>::fromGraph(branch);
+    EXPECT_EQ(branchNarrow.findShortestPath(0, 3).first, branch.findShortestPath(0, 3).first);
+    EXPECT_EQ(branchNarrow.findShortestPath(0, 3).second, (std::vector<int>{0, 3}));
+    EXPECT_THROW(branchNarrow.distancesFrom(0), std::overflow_error);
+
+    // 16-bit weights reject roads that do not fit
+    EXPECT_THROW(CompactRoadGraph::fromGraph(g), std::out_of_range);
+    EXPECT_THROW((CompactGraph<int, int, int>(2, {{0, 1, -1}})), std::invalid_argument);
+}
+
+TEST(CompactGraphTest, SmallerThanGraphCsr) {
+    Graph g = makeGridNetwork(60, 9, 500);
+    CompactRoadGraph compact = CompactRoadGraph::fromGraph(g);
+    const size_t arcs = static_cast<size_t>(g.getEdgeCount()) * 2;
+    const size_t graphBytes = (g.getVertexCount() + 1) * sizeof(int) + arcs * 2 * sizeof(int);
+    EXPECT_LT(compact.getMemoryBytes(), graphBytes);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "ContractionHierarchy.h"
+#include "test_helpers.h"
+#include <cstdlib>
+
+namespace {
+
+int pathLength(const Graph& graph, const std::vector<int>& path) {
+    int length = 0;
+    for (size_t i = 1; i < path.size(); ++i) {
+        int weight = graph.getEdgeWeight(path[i - 1], path[i]);
+        if (weight == std::numeric_limits<int>::max()) return -1;
+        length += weight;
+    }
+    return length;
+}
+
+}  // namespace
+
+TEST(ContractionHierarchyTest, MatchesDijkstraOnRandomGraph) {
+    const int n = 200;
+    Graph graph(n);
+    srand(31);
+    for (int i = 0; i < 600; ++i) {
+        graph.addEdge(rand() % n, rand() % n, rand() % 50 + 1);
+    }
+
+    ContractionHierarchy ch(graph);
+    EXPECT_EQ(ch.getVertexCount(), n);
+    for (int s = 0; s < n; s += 9) {
+        ShortestPathTree tree = graph.computeShortestPathTree(s);
+        for (int t = 0; t < n; ++t) {
+            auto result = ch.findShortestPath(s, t);
+            ASSERT_EQ(result.first, tree.distanceTo(t)) << s << " -> " << t;
+            EXPECT_EQ(ch.findShortestDistance(s, t), result.first);
+            if (tree.hasPathTo(t)) {
+                ASSERT_FALSE(result.second.empty());
+                EXPECT_EQ(result.second.front(), s);
+                EXPECT_EQ(result.second.back(), t);
+                EXPECT_EQ(pathLength(graph, result.second), result.first);
+            } else {
+                EXPECT_TRUE(result.second.empty());
+            }
+        }
+    }
+}
+
+TEST(ContractionHierarchyTest, GridNetworkAndRanks) {
+    Graph graph = makeGridNetwork(25, 5);
+    ContractionHierarchy ch(graph, 50);
+
+    std::vector<bool> seen(graph.getVertexCount(), false);
+    for (int v = 0; v < graph.getVertexCount(); ++v) {
+        int rank = ch.getRank(v);
+        ASSERT_GE(rank, 0);
+        ASSERT_LT(rank, graph.getVertexCount());
+        EXPECT_FALSE(seen[rank]);
+        seen[rank] = true;
+    }
+
+    for (int s = 0; s < graph.getVertexCount(); s += 37) {
+        for (int t = 0; t < graph.getVertexCount(); t += 11) {
+            auto expected = graph.findShortestPath(s, t);
+            auto result = ch.findShortestPath(s, t);
+            ASSERT_EQ(result.first, expected.first);
+            EXPECT_EQ(pathLength(graph, result.second), result.first);
+        }
+    }
+}
+
+TEST(ContractionHierarchyTest, TrivialAndInvalidQueries) {
+    Graph graph(4);
+    graph.addEdge(0, 1, 3);
+    graph.addEdge(2, 3, 4);
+    ContractionHierarchy ch(graph);
+
+    EXPECT_EQ(ch.findShortestPath(1, 1).first, 0);
+    EXPECT_EQ(ch.findShortestPath(1, 1).second, (std::vector<int>{1}));
+    EXPECT_EQ(ch.findShortestPath(0, 3).first, std::numeric_limits<int>::max());
+    EXPECT_TRUE(ch.findShortestPath(0, 3).second.empty());
+    EXPECT_THROW(ch.findShortestPath(0, 4), std::out_of_range);
+    EXPECT_THROW(ch.getRank(-1), std::out_of_range);
+    EXPECT_THROW(ContractionHierarchy(graph, 0), std::invalid_argument);
+}
+
+TEST(ContractionHierarchyTest, SettlesFewerVerticesThanDijkstra) {
+    Graph graph = makeGridNetwork(60, 9);
+    const int n = graph.getVertexCount();
+    ContractionHierarchy ch(graph);
+
+    SearchStats dijkstraStats, chStats;
+    int dijkstraDistance = graph.findShortestPath(0, n - 1, ShortestPathEngine::BinaryHeap, &dijkstraStats).first;
+    int chDistance = ch.findShortestPath(0, n - 1, &chStats).first;
+    EXPECT_EQ(chDistance, dijkstraDistance);
+    EXPECT_LT(chStats.settledVertices, dijkstraStats.settledVertices);
+}
+
+TEST(ContractionHierarchyTest, DistanceTableMatchesPointQueries) {
+    Graph graph = makeGridNetwork(20, 13);
+    // Detached pair of cities: unreachable from the grid
+    Graph withIsland = Graph::fromEdges(graph.getVertexCount() + 2,
+                                        std::vector<Graph::Edge>{{400, 401, 6}});
+    for (int u = 0; u < graph.getVertexCount(); ++u) {
+        graph.forEachNeighbor(u, [&](int v, int w) { if (u < v) withIsland.addEdge(u, v, w); });
+    }
+    ContractionHierarchy ch(withIsland);
+
+    std::vector<int> sources = {0, 57, 199, 401, 57};
+    std::vector<int> targets = {399, 0, 400, 123, 250, 17};
+    for (unsigned threads : {1u, 3u}) {
+        std::vector<int> table = ch.computeDistanceTable(sources, targets, threads);
+        ASSERT_EQ(table.size(), sources.size() * targets.size());
+        for (size_t i = 0; i < sources.size(); ++i) {
+            for (size_t j = 0; j < targets.size(); ++j) {
+                EXPECT_EQ(table[i * targets.size() + j], withIsland.findShortestPath(sources[i], targets[j]).first)
+                    << sources[i] << " -> " << targets[j];
+            }
+        }
+    }
+
+    EXPECT_TRUE(ch.computeDistanceTable({}, targets).empty());
+    EXPECT_TRUE(ch.computeDistanceTable(sources, {}).empty());
+    EXPECT_THROW(ch.computeDistanceTable({0}, {402}), std::out_of_range);
+}
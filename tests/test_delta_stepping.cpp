@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "DeltaStepping.h"
+#include "test_helpers.h"
+#include <cstdlib>
+
+namespace {
+
+// Every predecessor must lie on a shortest route
+void expectValidTree(const Graph& graph, const ShortestPathTree& tree) {
+    for (int v = 0; v < tree.getVertexCount(); ++v) {
+        int parent = tree.predecessorOf(v);
+        if (parent == -1) continue;
+        EXPECT_EQ(tree.distanceTo(parent) + graph.getEdgeWeight(parent, v), tree.distanceTo(v));
+    }
+}
+
+}  // namespace
+
+TEST(DeltaSteppingTest, MatchesDijkstraForAnyWidthAndThreadCount) {
+    Graph g = makeGridNetwork(20, 3, 30);
+    // A few long highways so some arcs are heavy for every width below
+    g.addEdge(0, 399, 150);
+    g.addEdge(19, 380, 120);
+    ShortestPathTree expected = g.computeShortestPathTree(7, ShortestPathEngine::BinaryHeap);
+
+    std::vector<int> reference;
+    for (int delta : {0, 1, 5, 40, 1000}) {
+        for (unsigned threads : {1u, 2u, 4u}) {
+            DeltaStepping solver(g, delta, threads);
+            EXPECT_GE(solver.getBucketWidth(), 1);
+            ShortestPathTree tree = solver.computeShortestPathTree(7);
+            ASSERT_EQ(tree.getDistances(), expected.getDistances())
+                << "delta " << delta << ", threads " << threads;
+            expectValidTree(g, tree);
+
+            // Tie-breaking does not depend on scheduling
+            if (reference.empty()) reference = tree.getPredecessors();
+            EXPECT_EQ(tree.getPredecessors(), reference);
+        }
+    }
+}
+
+TEST(DeltaSteppingTest, PointQueriesAndUnreachableVertices) {
+    Graph g(6);
+    g.addEdge(0, 1, 7);
+    g.addEdge(0, 2, 9);
+    g.addEdge(0, 5, 14);
+    g.addEdge(1, 2, 10);
+    g.addEdge(2, 5, 2);
+    DeltaStepping solver(g, 3, 2);
+
+    auto route = solver.findShortestPath(0, 5);
+    EXPECT_EQ(route.first, 11);
+    EXPECT_EQ(route.second, std::vector<int>({0, 2, 5}));
+
+    auto none = solver.findShortestPath(0, 4);
+    EXPECT_EQ(none.first, std::numeric_limits<int>::max());
+    EXPECT_TRUE(none.second.empty());
+
+    EXPECT_THROW(solver.findShortestPath(0, 6), std::out_of_range);
+    EXPECT_THROW(DeltaStepping(g, -1), std::invalid_argument);
+}
+
+TEST(DeltaSteppingTest, ZeroWeightRoadsKeepPredecessorsAcyclic) {
+    // A tie on 2-1 used to swap 2's predecessor to 1 while 1 pointed back at 2
+    Graph g(4);
+    g.addEdge(3, 2, 1);
+    g.addEdge(2, 1, 0);
+    for (unsigned threads : {1u, 2u}) {
+        DeltaStepping solver(g, 1, threads);
+        ShortestPathTree tree = solver.computeShortestPathTree(3);
+        EXPECT_EQ(tree.predecessorOf(2), 3);
+        EXPECT_EQ(tree.predecessorOf(1), 2);
+        EXPECT_EQ(tree.pathTo(1), std::vector<int>({3, 2, 1}));
+        EXPECT_EQ(solver.findShortestPath(3, 1), std::make_pair(1, std::vector<int>({3, 2, 1})));
+    }
+
+    // Zero-weight chains mixed into a grid still give valid trees
+    Graph grid = makeGridNetwork(12, 17);
+    srand(19);
+    for (int i = 0; i < 40; ++i) grid.addEdge(rand() % 144, rand() % 144, 0);
+    ShortestPathTree expected = grid.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap);
+    for (unsigned threads : {1u, 3u}) {
+        ShortestPathTree tree = DeltaStepping(grid, 2, threads).computeShortestPathTree(0);
+        ASSERT_EQ(tree.getDistances(), expected.getDistances());
+        expectValidTree(grid, tree);
+        for (int v = 0; v < 144; ++v) {
+            std::vector<int> path = tree.pathTo(v);  // would never return on a cycle
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(path.front(), 0);
+        }
+    }
+}
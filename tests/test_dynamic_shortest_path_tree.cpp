@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include "DynamicShortestPathTree.h"
+#include "test_helpers.h"
+#include <cstdlib>
+#include <limits>
+
+TEST(DynamicShortestPathTreeTest, RepairsAfterShortcut) {
+    Graph g(5);
+    g.addEdge(0, 1, 4);
+    g.addEdge(1, 2, 4);
+    g.addEdge(2, 3, 4);
+    DynamicShortestPathTree tree(g, 0);
+    EXPECT_EQ(tree.distanceTo(3), 12);
+    EXPECT_EQ(tree.distanceTo(4), std::numeric_limits<int>::max());
+
+    // Bypass from 0 straight to 2 improves 2 and 3 but not 1
+    EXPECT_EQ(tree.addEdge(0, 2, 3), 2);
+    EXPECT_EQ(tree.distanceTo(1), 4);
+    EXPECT_EQ(tree.distanceTo(2), 3);
+    EXPECT_EQ(tree.distanceTo(3), 7);
+    EXPECT_EQ(tree.pathTo(3), std::vector<int>({0, 2, 3}));
+
+    // A longer parallel road changes nothing
+    EXPECT_EQ(tree.addEdge(0, 2, 10), 0);
+    EXPECT_EQ(tree.distanceTo(2), 3);
+
+    // Connecting a new vertex reaches it
+    EXPECT_EQ(tree.addEdge(3, 4, 1), 1);
+    EXPECT_EQ(tree.pathTo(4), std::vector<int>({0, 2, 3, 4}));
+}
+
+TEST(DynamicShortestPathTreeTest, MatchesFullRecomputation) {
+    Graph g = makeGridNetwork(12, 7);
+    const int n = g.getVertexCount();
+    DynamicShortestPathTree tree(g, 5);
+
+    srand(99);
+    for (int edit = 0; edit < 60; ++edit) {
+        int u = rand() % n, v = rand() % n;
+        tree.addEdge(u, v, rand() % 20 + 1);
+
+        ShortestPathTree expected = g.computeShortestPathTree(5, ShortestPathEngine::BinaryHeap);
+        ASSERT_EQ(tree.snapshot().getDistances(), expected.getDistances()) << "edit " << edit;
+    }
+
+    // Every predecessor chain must still be a valid shortest route
+    for (int v = 0; v < n; ++v) {
+        std::vector<int> path = tree.pathTo(v);
+        int length = 0;
+        for (size_t i = 1; i < path.size(); ++i) length += g.getEdgeWeight(path[i - 1], path[i]);
+        EXPECT_EQ(length, tree.distanceTo(v));
+    }
+}
+
+TEST(DynamicShortestPathTreeTest, RecomputesAfterExternalEdits) {
+    Graph g(3);
+    g.addEdge(0, 1, 5);
+    DynamicShortestPathTree tree(g, 0);
+    EXPECT_FALSE(tree.isStale());
+
+    g.addEdge(1, 2, 5);
+    EXPECT_TRUE(tree.isStale());
+    tree.addEdge(0, 1, 2);
+    EXPECT_FALSE(tree.isStale());
+    EXPECT_EQ(tree.distanceTo(2), 7);
+
+    EXPECT_THROW(tree.distanceTo(3), std::out_of_range);
+    EXPECT_THROW(tree.addEdge(0, 3, 1), std::out_of_range);
+}
+
+TEST(DynamicShortestPathTreeTest, RepairsAfterClosureAndSlowdown) {
+    Graph g(6);
+    g.addEdge(0, 1, 2);
+    g.addEdge(1, 2, 2);
+    g.addEdge(2, 3, 2);
+    g.addEdge(0, 4, 5);
+    g.addEdge(4, 3, 5);
+    g.addEdge(3, 5, 1);
+    DynamicShortestPathTree tree(g, 0);
+    EXPECT_EQ(tree.pathTo(5), std::vector<int>({0, 1, 2, 3, 5}));
+
+    // A road off the tree carries no routes
+    EXPECT_EQ(tree.setEdgeWeight(0, 4, 7), 1);  // 4 itself hangs off that road
+    EXPECT_EQ(tree.setEdgeWeight(4, 3, 9), 0);
+    EXPECT_EQ(tree.getLastUpdatedVertices(), 0);
+
+    // Slowing 1-2 pushes 2, 3 and 5 further out along the same route
+    EXPECT_EQ(tree.setEdgeWeight(1, 2, 3), 3);
+    EXPECT_EQ(tree.distanceTo(5), 8);
+
+    // Closing 2-3 reroutes 3 and 5 through 4; 2 is unaffected
+    EXPECT_EQ(tree.removeEdge(3, 2), 2);
+    EXPECT_EQ(tree.pathTo(5), std::vector<int>({0, 4, 3, 5}));
+    EXPECT_EQ(tree.distanceTo(2), 5);
+    EXPECT_EQ(tree.removeEdge(3, 2), 0);
+
+    // Cutting the last route strands the subtree
+    EXPECT_EQ(tree.removeEdge(4, 3), 2);
+    EXPECT_EQ(tree.distanceTo(5), std::numeric_limits<int>::max());
+    EXPECT_TRUE(tree.pathTo(3).empty());
+    EXPECT_EQ(tree.predecessorOf(5), -1);
+    EXPECT_THROW(tree.setEdgeWeight(0, 5, 1), std::invalid_argument);
+
+    // Shortening through setEdgeWeight reuses the improvement repair
+    g.addEdge(2, 5, 4);
+    EXPECT_TRUE(tree.isStale());
+    EXPECT_EQ(tree.setEdgeWeight(2, 5, 1), 6);  // stale, so a full refresh
+    EXPECT_EQ(tree.distanceTo(3), 7);
+    EXPECT_EQ(tree.setEdgeWeight(2, 5, 0), 2);
+    EXPECT_EQ(tree.distanceTo(3), 6);
+}
+
+TEST(DynamicShortestPathTreeTest, ClosuresMatchFullRecomputation) {
+    Graph g = makeGridNetwork(14, 3);
+    const int n = g.getVertexCount();
+    DynamicShortestPathTree tree(g, 17);
+
+    srand(61);
+    for (int edit = 0; edit < 150; ++edit) {
+        int u = rand() % n;
+        std::vector<int> around;
+        g.forEachNeighbor(u, [&](int v, int) { around.push_back(v); });
+        if (around.empty()) continue;
+        int v = around[rand() % around.size()];
+
+        switch (edit % 3) {
+            case 0: tree.removeEdge(u, v); break;
+            case 1: tree.setEdgeWeight(u, v, g.getEdgeWeight(u, v) + rand() % 10); break;
+            default: tree.addEdge(u, rand() % n, rand() % 20 + 1); break;
+        }
+
+        ShortestPathTree expected = g.computeShortestPathTree(17, ShortestPathEngine::BinaryHeap);
+        ASSERT_EQ(tree.snapshot().getDistances(), expected.getDistances()) << "edit " << edit;
+    }
+
+    for (int v = 0; v < n; ++v) {
+        std::vector<int> path = tree.pathTo(v);
+        int length = 0;
+        for (size_t i = 1; i < path.size(); ++i) length += g.getEdgeWeight(path[i - 1], path[i]);
+        EXPECT_EQ(length, path.empty() ? 0 : tree.distanceTo(v));
+    }
+}
+
+TEST(DynamicShortestPathTreeTest, ClosureRepairTouchesFewerVerticesThanRecompute) {
+    Graph g = makeGridNetwork(60, 23);
+    const int n = g.getVertexCount();
+    DynamicShortestPathTree tree(g, 0);
+
+    // Close or slow down random roads, as a batch of construction plans would
+    srand(8);
+    const int edits = 100;
+    long long updated = 0;
+    for (int edit = 0; edit < edits; ++edit) {
+        int u = rand() % n;
+        int v = u + 1 < n && rand() % 2 ? u + 1 : (u + 60 < n ? u + 60 : u - 1);
+        if (g.getEdgeWeight(u, v) == std::numeric_limits<int>::max()) continue;
+        updated += edit % 2 ? tree.removeEdge(u, v) : tree.setEdgeWeight(u, v, g.getEdgeWeight(u, v) * 3);
+    }
+
+    EXPECT_EQ(tree.snapshot().getDistances(),
+              g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap).getDistances());
+    EXPECT_LT(updated, static_cast<long long>(n) * edits);
+}
+
+TEST(DynamicShortestPathTreeTest, BypassRepairTouchesFewerVerticesThanRecompute) {
+    Graph g = makeGridNetwork(60, 11);
+    const int n = g.getVertexCount();
+    DynamicShortestPathTree tree(g, 0);
+
+    srand(5);
+    long long updated = 0;
+    for (int i = 0; i < 50; ++i) {
+        int from = rand() % n, to = rand() % n;
+        updated += tree.addEdge(from, to, rand() % 30 + 5);
+    }
+
+    EXPECT_EQ(tree.snapshot().getDistances(),
+              g.computeShortestPathTree(0, ShortestPathEngine::BinaryHeap).getDistances());
+    EXPECT_LT(updated, static_cast<long long>(n) * 50);
+}
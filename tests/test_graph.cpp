@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "Graph.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <numeric>
 
 class GraphTest : public ::testing::Test {
 protected:
@@ -80,4 +83,896 @@ TEST_F(GraphTest, InvalidVertexTest) {
     EXPECT_THROW(graph->addEdge(5, 0, 10), std::out_of_range);
     EXPECT_THROW(graph->addEdge(0, 5, 10), std::out_of_range);
     EXPECT_THROW(graph->findShortestPath(0, 5), std::out_of_range);
-} 
\ No newline at end of file
+} 
+
+TEST(GraphStorageTest, SparseIsDefault) {
+    Graph g(4);
+    EXPECT_EQ(g.getStorage(), GraphStorage::Sparse);
+    EXPECT_EQ(g.getEdgeCount(), 0);
+}
+
+TEST(GraphStorageTest, SparseKeepsMinimumWeight) {
+    Graph g(3);
+    g.addEdge(0, 1, 10);
+    g.addEdge(1, 0, 7);
+    g.addEdge(0, 1, 12);
+    EXPECT_EQ(g.getEdgeWeight(0, 1), 7);
+    EXPECT_EQ(g.getEdgeWeight(1, 0), 7);
+    EXPECT_EQ(g.getEdgeCount(), 1);
+
+    // Lowering an already compacted edge updates it in place
+    g.addEdge(1, 0, 3);
+    EXPECT_EQ(g.getEdgeWeight(0, 1), 3);
+    EXPECT_EQ(g.getEdgeWeight(0, 2), std::numeric_limits<int>::max());
+    EXPECT_EQ(g.getEdgeWeight(2, 2), 0);
+}
+
+TEST(GraphStorageTest, EdgesAddedAfterQueryAreMerged) {
+    Graph g(4);
+    g.addEdge(0, 1, 5);
+    g.addEdge(1, 2, 5);
+    EXPECT_EQ(g.findShortestPath(0, 3).first, std::numeric_limits<int>::max());
+
+    g.addEdge(2, 3, 5);
+    g.addEdge(0, 3, 12);
+    auto result = g.findShortestPath(0, 3);
+    EXPECT_EQ(result.first, 12);
+    EXPECT_EQ(result.second, (std::vector<int>{0, 3}));
+    EXPECT_EQ(g.getEdgeCount(), 4);
+}
+
+TEST(GraphStorageTest, SparseMatchesDense) {
+    const int n = 60;
+    Graph dense(n, GraphStorage::Dense);
+    Graph sparse(n, GraphStorage::Sparse);
+    srand(42);
+    for (int i = 0; i < 240; ++i) {
+        int u = rand() % n, v = rand() % n, w = rand() % 50 + 1;
+        dense.addEdge(u, v, w);
+        sparse.addEdge(u, v, w);
+    }
+    EXPECT_EQ(dense.getEdgeCount(), sparse.getEdgeCount());
+    for (int s = 0; s < n; s += 7) {
+        for (int t = 0; t < n; ++t) {
+            EXPECT_EQ(dense.findShortestPath(s, t).first, sparse.findShortestPath(s, t).first);
+        }
+    }
+}
+
+TEST(GraphStorageTest, ForEachNeighborVisitsSortedRow) {
+    Graph g(4);
+    g.addEdge(2, 3, 1);
+    g.addEdge(2, 0, 4);
+    g.addEdge(1, 2, 2);
+    std::vector<int> seen;
+    g.forEachNeighbor(2, [&](int v, int) { seen.push_back(v); });
+    EXPECT_EQ(seen, (std::vector<int>{0, 1, 3}));
+}
+
+TEST(GraphStorageTest, LargeSparseNetwork) {
+    // A dense matrix of this size would need ~160 GB
+    const int n = 200000;
+    Graph g(n);
+    for (int i = 0; i + 1 < n; ++i) {
+        g.addEdge(i, i + 1, 1);
+    }
+    EXPECT_EQ(g.getEdgeCount(), n - 1);
+    EXPECT_EQ(g.getEdgeWeight(n - 2, n - 1), 1);
+}
+
+TEST(GraphEngineTest, AutoResolvesByStorage) {
+    Graph sparse(3);
+    Graph dense(3, GraphStorage::Dense);
+    EXPECT_EQ(sparse.getShortestPathEngine(), ShortestPathEngine::Auto);
+    sparse.setShortestPathEngine(ShortestPathEngine::LinearScan);
+    EXPECT_EQ(sparse.getShortestPathEngine(), ShortestPathEngine::LinearScan);
+
+    Graph heapGraph(3, GraphStorage::Dense, ShortestPathEngine::BinaryHeap);
+    heapGraph.addEdge(0, 1, 2);
+    heapGraph.addEdge(1, 2, 2);
+    heapGraph.addEdge(0, 2, 9);
+    EXPECT_EQ(heapGraph.findShortestPath(0, 2).first, 4);
+    EXPECT_EQ(heapGraph.findShortestPath(0, 2).second, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(GraphEngineTest, EnginesAgree) {
+    const int n = 80;
+    Graph g(n);
+    srand(7);
+    for (int i = 0; i < 300; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 40 + 1);
+    }
+    for (int s = 0; s < n; s += 5) {
+        for (int t = 0; t < n; ++t) {
+            auto linear = g.findShortestPath(s, t, ShortestPathEngine::LinearScan);
+            auto heap = g.findShortestPath(s, t, ShortestPathEngine::BinaryHeap);
+            ASSERT_EQ(linear.first, heap.first);
+            if (heap.first != std::numeric_limits<int>::max()) {
+                ASSERT_EQ(heap.second.front(), s);
+                ASSERT_EQ(heap.second.back(), t);
+                int length = 0;
+                for (size_t i = 1; i < heap.second.size(); ++i) {
+                    length += g.getEdgeWeight(heap.second[i - 1], heap.second[i]);
+                }
+                EXPECT_EQ(length, heap.first);
+            }
+        }
+    }
+}
+
+TEST(GraphEngineTest, StopsWhenDestinationSettled) {
+    // Path graph 0 - 1 - ... - 99: vertex 1 is settled second
+    Graph g(100);
+    for (int i = 0; i + 1 < 100; ++i) {
+        g.addEdge(i, i + 1, 1);
+    }
+    for (auto engine : {ShortestPathEngine::LinearScan, ShortestPathEngine::BinaryHeap}) {
+        SearchStats stats;
+        auto result = g.findShortestPath(0, 1, engine, &stats);
+        EXPECT_EQ(result.first, 1);
+        EXPECT_EQ(result.second, (std::vector<int>{0, 1}));
+        EXPECT_EQ(stats.settledVertices, 2);
+
+        SearchStats farStats;
+        EXPECT_EQ(g.findShortestPath(0, 99, engine, &farStats).first, 99);
+        EXPECT_EQ(farStats.settledVertices, 100);
+    }
+}
+
+TEST(GraphEngineTest, RouteLongerThanIntMaxThrows) {
+    const int half = std::numeric_limits<int>::max() / 2 + 1;
+    for (GraphStorage storage : {GraphStorage::Sparse, GraphStorage::Dense}) {
+        Graph g(4, storage);
+        g.addEdge(0, 1, half);
+        g.addEdge(1, 2, half);                                   // 0 -> 2 is INT_MAX + 1
+        g.addEdge(0, 3, std::numeric_limits<int>::max() - 1);  // long but representable
+
+        std::vector<ShortestPathEngine> engines = {ShortestPathEngine::LinearScan};
+        if (storage == GraphStorage::Sparse) {
+            engines.insert(engines.end(), {ShortestPathEngine::BinaryHeap, ShortestPathEngine::RadixHeap,
+                                           ShortestPathEngine::Bidirectional});
+        }
+        for (ShortestPathEngine engine : engines) {
+            EXPECT_THROW(g.findShortestPath(0, 2, engine), std::overflow_error);
+            EXPECT_EQ(g.findShortestPath(0, 3, engine).first, std::numeric_limits<int>::max() - 1);
+            EXPECT_EQ(g.findShortestPath(0, 1, engine).first, half);
+            EXPECT_THROW(g.findShortestDistance(0, 2, engine), std::overflow_error);
+        }
+        EXPECT_THROW(g.computeShortestPathTree(0), std::overflow_error);
+    }
+
+    // The two frontiers stall before they meet
+    Graph chain(4, GraphStorage::Sparse, ShortestPathEngine::Bidirectional);
+    chain.addEdge(0, 1, half);
+    chain.addEdge(1, 2, 1);
+    chain.addEdge(2, 3, half);
+    EXPECT_THROW(chain.findShortestPath(0, 3), std::overflow_error);
+    EXPECT_EQ(chain.findShortestPath(0, 2).first, half + 1);
+}
+
+TEST(GraphEngineTest, LocalQueriesSettleFewVertices) {
+    // 60 x 60 grid road network; local queries stay near the source corner
+    const int side = 60;
+    const int n = side * side;
+    Graph g = makeGridNetwork(side, 3);
+
+    SearchStats local, cross;
+    g.findShortestPath(0, side + 1, ShortestPathEngine::BinaryHeap, &local);
+    g.findShortestPath(0, n - 1, ShortestPathEngine::BinaryHeap, &cross);
+    EXPECT_LT(local.settledVertices, n / 20);
+    EXPECT_LE(cross.settledVertices, n);
+}
+
+TEST(ShortestPathTreeTest, AnswersEveryDestination) {
+    const int n = 50;
+    Graph g(n);
+    srand(19);
+    for (int i = 0; i < 150; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 30 + 1);
+    }
+
+    ShortestPathTree tree = g.computeShortestPathTree(4);
+    EXPECT_EQ(tree.getSource(), 4);
+    EXPECT_EQ(tree.getVertexCount(), n);
+    EXPECT_EQ(tree.distanceTo(4), 0);
+    EXPECT_EQ(tree.predecessorOf(4), -1);
+    for (int t = 0; t < n; ++t) {
+        auto direct = g.findShortestPath(4, t);
+        EXPECT_EQ(tree.distanceTo(t), direct.first);
+        EXPECT_EQ(tree.hasPathTo(t), !direct.second.empty());
+        std::vector<int> path = tree.pathTo(t);
+        if (!path.empty()) {
+            EXPECT_EQ(path.front(), 4);
+            EXPECT_EQ(path.back(), t);
+        }
+    }
+    EXPECT_THROW(tree.distanceTo(n), std::out_of_range);
+    EXPECT_THROW(g.computeShortestPathTree(-1), std::out_of_range);
+}
+
+TEST(ShortestPathTreeTest, UnreachableVertices) {
+    Graph g(4, GraphStorage::Dense);
+    g.addEdge(0, 1, 3);
+    g.addEdge(2, 3, 1);
+    ShortestPathTree tree = g.computeShortestPathTree(0, ShortestPathEngine::LinearScan);
+    EXPECT_EQ(tree.distanceTo(1), 3);
+    EXPECT_FALSE(tree.hasPathTo(3));
+    EXPECT_TRUE(tree.pathTo(3).empty());
+    EXPECT_EQ(tree.pathTo(1), (std::vector<int>{0, 1}));
+}
+
+TEST(GraphBatchTest, MatchesIndividualQueries) {
+    const int n = 120;
+    Graph g(n);
+    srand(23);
+    for (int i = 0; i < 400; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 60 + 1);
+    }
+
+    std::vector<std::pair<int, int>> queries;
+    for (int i = 0; i < 300; ++i) {
+        queries.push_back({rand() % 10, rand() % n});  // few sources, many destinations
+    }
+    queries.push_back({5, 5});
+
+    auto results = g.findShortestPaths(queries, 4);
+    ASSERT_EQ(results.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto expected = g.findShortestPath(queries[i].first, queries[i].second);
+        EXPECT_EQ(results[i].first, expected.first);
+        if (!results[i].second.empty()) {
+            EXPECT_EQ(results[i].second.front(), queries[i].first);
+            EXPECT_EQ(results[i].second.back(), queries[i].second);
+        }
+    }
+
+    EXPECT_TRUE(g.findShortestPaths({}, 2).empty());
+    EXPECT_THROW(g.findShortestPaths({{0, n}}, 2), std::out_of_range);
+}
+
+TEST(GraphBatchTest, OtherComponentGroupsAreUnreachable) {
+    Graph g(5);
+    g.addEdge(0, 1, 3);
+    g.addEdge(1, 2, 4);
+    g.addEdge(3, 4, 2);
+
+    auto results = g.findShortestPaths({{0, 3}, {0, 4}, {3, 4}, {1, 2}, {1, 4}}, 2);
+    ASSERT_EQ(results.size(), 5u);
+    for (size_t i : {0u, 1u, 4u}) {
+        EXPECT_EQ(results[i].first, std::numeric_limits<int>::max());
+        EXPECT_TRUE(results[i].second.empty());
+    }
+    EXPECT_EQ(results[2].first, 2);
+    EXPECT_EQ(results[3].second, (std::vector<int>{1, 2}));
+}
+
+TEST(AllPairsTest, MatchesDijkstra) {
+    const int n = 150;  // not a multiple of the block size
+    Graph g(n);
+    srand(29);
+    for (int i = 0; i < 450; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 100 + 1);
+    }
+    g.addEdge(n - 1, n - 2, 1);
+
+    std::vector<int> table = g.computeAllPairsDistances(3, 32);
+    ASSERT_EQ(table.size(), static_cast<size_t>(n) * n);
+    for (int s = 0; s < n; ++s) {
+        ShortestPathTree tree = g.computeShortestPathTree(s);
+        for (int t = 0; t < n; ++t) {
+            ASSERT_EQ(table[s * n + t], tree.distanceTo(t)) << s << " -> " << t;
+        }
+    }
+    EXPECT_EQ(g.computeAllPairsDistances(1), table);
+}
+
+TEST(AllPairsTest, DenseStorageAndDisconnected) {
+    Graph g(5, GraphStorage::Dense);
+    g.addEdge(0, 1, 4);
+    g.addEdge(1, 2, 4);
+    g.addEdge(3, 4, 1);
+    std::vector<int> table = g.computeAllPairsDistances(2, 2);
+    EXPECT_EQ(table[0 * 5 + 2], 8);
+    EXPECT_EQ(table[4 * 5 + 3], 1);
+    EXPECT_EQ(table[0 * 5 + 4], std::numeric_limits<int>::max());
+    EXPECT_EQ(table[3 * 5 + 3], 0);
+    EXPECT_THROW(g.computeAllPairsDistances(1, 0), std::invalid_argument);
+    EXPECT_TRUE(Graph(0).computeAllPairsDistances().empty());
+}
+
+TEST(LandmarkTest, AStarMatchesDijkstra) {
+    const int n = 150;
+    Graph g(n);
+    srand(37);
+    for (int i = 0; i < 350; ++i) {
+        int u = rand() % (n - 10), v = rand() % (n - 10);  // last 10 vertices isolated
+        g.addEdge(u, v, rand() % 70 + 1);
+    }
+    g.addEdge(n - 1, n - 2, 5);
+
+    EXPECT_THROW(g.findShortestPath(0, 1, ShortestPathEngine::AStarLandmarks), std::logic_error);
+    g.selectLandmarks(6);
+    ASSERT_EQ(g.getLandmarks().size(), 6u);
+
+    for (int s = 0; s < n; s += 13) {
+        for (int t = 0; t < n; ++t) {
+            auto expected = g.findShortestPath(s, t, ShortestPathEngine::BinaryHeap);
+            auto result = g.findShortestPath(s, t, ShortestPathEngine::AStarLandmarks);
+            ASSERT_EQ(result.first, expected.first) << s << " -> " << t;
+            if (!result.second.empty()) {
+                EXPECT_EQ(result.second.front(), s);
+                EXPECT_EQ(result.second.back(), t);
+            }
+        }
+    }
+}
+
+TEST(LandmarkTest, RecomputedAfterEdits) {
+    Graph g(5);
+    g.addEdge(0, 1, 10);
+    g.addEdge(1, 2, 10);
+    g.addEdge(2, 3, 10);
+    g.addEdge(3, 4, 10);
+    g.setLandmarks({0, 4});
+    EXPECT_EQ(g.findShortestPath(0, 4, ShortestPathEngine::AStarLandmarks).first, 40);
+
+    // A new bypass shrinks distances; stale bounds would overestimate
+    g.addEdge(0, 4, 3);
+    EXPECT_EQ(g.findShortestPath(1, 4, ShortestPathEngine::AStarLandmarks).first, 13);
+    EXPECT_EQ(g.findShortestPath(1, 4, ShortestPathEngine::AStarLandmarks).second,
+              (std::vector<int>{1, 0, 4}));
+
+    EXPECT_THROW(g.setLandmarks({5}), std::out_of_range);
+    EXPECT_THROW(g.selectLandmarks(0), std::invalid_argument);
+}
+
+TEST(LandmarkTest, SettlesFewerVerticesThanDijkstra) {
+    const int side = 60;
+    const int n = side * side;
+    Graph g = makeGridNetwork(side, 41);
+    g.selectLandmarks(8);
+
+    SearchStats dijkstra, alt;
+    int plainDistance = g.findShortestPath(side - 1, n - side, ShortestPathEngine::BinaryHeap, &dijkstra).first;
+    int altDistance = g.findShortestPath(side - 1, n - side, ShortestPathEngine::AStarLandmarks, &alt).first;
+    EXPECT_EQ(plainDistance, altDistance);
+    EXPECT_LT(alt.settledVertices, dijkstra.settledVertices);
+}
+
+TEST(BidirectionalTest, MatchesDijkstra) {
+    const int n = 150;
+    Graph g(n, GraphStorage::Sparse, ShortestPathEngine::Bidirectional);
+    srand(43);
+    for (int i = 0; i < 320; ++i) {
+        g.addEdge(rand() % (n - 5), rand() % (n - 5), rand() % 80 + 1);
+    }
+
+    for (int s = 0; s < n; s += 11) {
+        for (int t = 0; t < n; ++t) {
+            auto expected = g.findShortestPath(s, t, ShortestPathEngine::BinaryHeap);
+            auto result = g.findShortestPath(s, t);
+            ASSERT_EQ(result.first, expected.first) << s << " -> " << t;
+            if (expected.first == std::numeric_limits<int>::max()) {
+                EXPECT_TRUE(result.second.empty());
+                continue;
+            }
+            ASSERT_EQ(result.second.front(), s);
+            ASSERT_EQ(result.second.back(), t);
+            int length = 0;
+            for (size_t i = 1; i < result.second.size(); ++i) {
+                length += g.getEdgeWeight(result.second[i - 1], result.second[i]);
+            }
+            EXPECT_EQ(length, result.first);
+        }
+    }
+    EXPECT_EQ(g.findShortestPath(3, 3).second, (std::vector<int>{3}));
+}
+
+TEST(BidirectionalTest, SettlesFewerVerticesThanDijkstra) {
+    const int side = 60;
+    const int n = side * side;
+    Graph g = makeGridNetwork(side, 47);
+
+    // Long-haul query between opposite corners
+    const int source = side - 1, target = n - side;
+    SearchStats oneWay, twoWay;
+    int oneWayDistance = g.findShortestPath(source, target, ShortestPathEngine::BinaryHeap, &oneWay).first;
+    int twoWayDistance = g.findShortestPath(source, target, ShortestPathEngine::Bidirectional, &twoWay).first;
+    EXPECT_EQ(oneWayDistance, twoWayDistance);
+    EXPECT_LT(twoWay.settledVertices, oneWay.settledVertices);
+}
+
+TEST(RouteCacheTest, HitsMissesAndReverseLookup) {
+    Graph g(4);
+    g.addEdge(0, 1, 2);
+    g.addEdge(1, 2, 3);
+    g.addEdge(2, 3, 4);
+    g.enableRouteCache(8);
+
+    auto first = g.findShortestPath(0, 3);
+    auto again = g.findShortestPath(0, 3);
+    auto reverse = g.findShortestPath(3, 0);
+    EXPECT_EQ(g.getCacheMisses(), 1u);
+    EXPECT_EQ(g.getCacheHits(), 2u);
+    EXPECT_EQ(again, first);
+    EXPECT_EQ(reverse.first, 9);
+    EXPECT_EQ(reverse.second, std::vector<int>({3, 2, 1, 0}));
+}
+
+TEST(RouteCacheTest, InvalidatedByEdits) {
+    Graph g(3);
+    g.addEdge(0, 1, 5);
+    g.addEdge(1, 2, 5);
+    g.enableRouteCache(4);
+
+    EXPECT_EQ(g.findShortestPath(0, 2).first, 10);
+    unsigned long long before = g.getVersion();
+    g.addEdge(0, 2, 3);
+    EXPECT_GT(g.getVersion(), before);
+    EXPECT_EQ(g.findShortestPath(0, 2).first, 3);
+    EXPECT_EQ(g.getCacheHits(), 0u);
+    EXPECT_EQ(g.getCacheMisses(), 2u);
+}
+
+TEST(RouteCacheTest, EvictsLeastRecentlyUsed) {
+    Graph g(4);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 2, 1);
+    g.addEdge(2, 3, 1);
+    g.enableRouteCache(2);
+
+    g.findShortestPath(0, 1);
+    g.findShortestPath(0, 2);
+    g.findShortestPath(0, 1);  // refresh (0, 1)
+    g.findShortestPath(0, 3);  // evicts (0, 2)
+    g.findShortestPath(0, 1);
+    g.findShortestPath(0, 2);
+    EXPECT_EQ(g.getCacheHits(), 2u);
+    EXPECT_EQ(g.getCacheMisses(), 4u);
+
+    g.disableRouteCache();
+    g.findShortestPath(0, 1);
+    EXPECT_EQ(g.getCacheHits(), 0u);
+    EXPECT_EQ(g.getCacheMisses(), 0u);
+}
+
+TEST(BulkBuildTest, MatchesIncrementalConstruction) {
+    srand(31);
+    std::vector<Graph::Edge> edges;
+    for (int i = 0; i < 500; ++i) {
+        edges.push_back({rand() % 60, rand() % 60, rand() % 25 + 1});
+    }
+    edges.push_back({4, 4, 1});     // self loop is dropped
+    edges.push_back({1, 2, 9});
+    edges.push_back({2, 1, 3});     // reversed duplicate keeps the minimum
+
+    Graph incremental(60);
+    for (const Graph::Edge& edge : edges) incremental.addEdge(edge.from, edge.to, edge.weight);
+    Graph bulk = Graph::fromEdges(60, edges);
+    Graph fromRange = Graph::fromEdges(60, edges.begin(), edges.end(), GraphStorage::Dense);
+
+    EXPECT_EQ(bulk.getEdgeCount(), incremental.getEdgeCount());
+    EXPECT_EQ(bulk.getEdgeWeight(1, 2), incremental.getEdgeWeight(1, 2));
+    for (int u = 0; u < 60; ++u) {
+        for (int v = 0; v < 60; ++v) {
+            ASSERT_EQ(bulk.getEdgeWeight(u, v), incremental.getEdgeWeight(u, v));
+            ASSERT_EQ(fromRange.getEdgeWeight(u, v), incremental.getEdgeWeight(u, v));
+        }
+    }
+    EXPECT_EQ(bulk.computeShortestPathTree(0).getDistances(),
+              incremental.computeShortestPathTree(0).getDistances());
+
+    // Bulk-built graphs stay editable
+    bulk.addEdge(0, 59, 1);
+    EXPECT_EQ(bulk.findShortestPath(0, 59).first, 1);
+
+    EXPECT_THROW(Graph::fromEdges(3, std::vector<Graph::Edge>{{0, 3, 1}}), std::out_of_range);
+}
+
+TEST(QueryWorkspaceTest, LazyResetBetweenQueries) {
+    QueryWorkspace workspace;
+    workspace.reset(4);
+    EXPECT_EQ(workspace.getVertexCount(), 4);
+    workspace.update(2, 7, 1);
+    EXPECT_EQ(workspace.distanceTo(2), 7);
+    EXPECT_EQ(workspace.predecessorOf(2), 1);
+
+    workspace.reset(4);
+    EXPECT_EQ(workspace.distanceTo(2), QueryWorkspace::UNREACHED);
+    EXPECT_EQ(workspace.predecessorOf(2), -1);
+    EXPECT_TRUE(workspace.pathTo(2).empty());
+    EXPECT_TRUE(workspace.heapStorage().empty());
+}
+
+TEST(QueryWorkspaceTest, ReusedWorkspaceMatchesFreshSearches) {
+    const int n = 300;
+    Graph g(n);
+    srand(41);
+    for (int i = 0; i < 1200; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 50 + 1);
+    }
+    Graph small(3);
+    small.addEdge(0, 1, 4);
+
+    QueryWorkspace workspace;
+    for (int q = 0; q < 200; ++q) {
+        int s = rand() % n, t = rand() % n;
+        auto reused = g.findShortestPath(s, t, workspace);
+        auto fresh = g.findShortestPath(s, t, ShortestPathEngine::LinearScan);
+        ASSERT_EQ(reused.first, fresh.first);
+        if (reused.first != std::numeric_limits<int>::max()) {
+            ASSERT_EQ(reused.second.front(), s);
+            ASSERT_EQ(reused.second.back(), t);
+        }
+
+        // Switching graphs resizes the workspace transparently
+        if (q % 50 == 0) {
+            EXPECT_EQ(small.findShortestPath(0, 1, workspace).first, 4);
+            EXPECT_EQ(small.findShortestPath(0, 2, workspace).first, std::numeric_limits<int>::max());
+        }
+    }
+    EXPECT_THROW(g.findShortestPath(0, n, workspace), std::out_of_range);
+}
+
+TEST(ComponentIndexTest, TracksAddEdgeAndBulkBuild) {
+    Graph g(6);
+    EXPECT_EQ(g.getComponentCount(), 6);
+    g.addEdge(0, 1, 3);
+    g.addEdge(2, 3, 1);
+    g.addEdge(1, 0, 2);  // parallel road, no merge
+    g.addEdge(4, 4, 1);  // self loop
+    EXPECT_EQ(g.getComponentCount(), 4);
+    EXPECT_TRUE(g.isConnected(1, 0));
+    EXPECT_FALSE(g.isConnected(1, 2));
+    EXPECT_TRUE(g.isConnected(5, 5));
+
+    g.addEdge(1, 3, 4);
+    EXPECT_EQ(g.getComponentCount(), 3);
+    EXPECT_TRUE(g.isConnected(0, 2));
+    EXPECT_THROW(g.isConnected(0, 6), std::out_of_range);
+
+    Graph bulk = Graph::fromEdges(6, std::vector<Graph::Edge>{{0, 1, 3}, {2, 3, 1}, {1, 3, 4}, {4, 4, 1}});
+    EXPECT_EQ(bulk.getComponentCount(), 3);
+    EXPECT_TRUE(bulk.isConnected(0, 2));
+    EXPECT_FALSE(bulk.isConnected(0, 4));
+
+    Graph dense(4, GraphStorage::Dense);
+    dense.addEdge(0, 2, 5);
+    EXPECT_EQ(dense.getComponentCount(), 3);
+    EXPECT_TRUE(dense.isConnected(2, 0));
+}
+
+TEST(ComponentIndexTest, CrossComponentQueriesDoNoWork) {
+    Graph g(7);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 2, 1);
+    g.addEdge(2, 3, 1);
+    g.addEdge(4, 5, 1);
+    g.selectLandmarks(2);
+
+    for (ShortestPathEngine engine : {ShortestPathEngine::LinearScan, ShortestPathEngine::BinaryHeap,
+                                      ShortestPathEngine::AStarLandmarks, ShortestPathEngine::Bidirectional}) {
+        SearchStats stats;
+        auto result = g.findShortestPath(0, 5, engine, &stats);
+        EXPECT_EQ(result.first, std::numeric_limits<int>::max());
+        EXPECT_TRUE(result.second.empty());
+        EXPECT_EQ(stats.settledVertices, 0);
+        EXPECT_EQ(g.findShortestPath(0, 3, engine).first, 3);
+    }
+
+    QueryWorkspace workspace;
+    SearchStats stats;
+    EXPECT_EQ(g.findShortestPath(3, 6, workspace, &stats).first, std::numeric_limits<int>::max());
+    EXPECT_EQ(stats.settledVertices, 0);
+
+    // Joining the components makes the route available
+    g.addEdge(3, 4, 2);
+    EXPECT_EQ(g.findShortestPath(0, 5).first, 6);
+}
+
+TEST(RoadClosureTest, RemoveAndReweighBothStorages) {
+    for (GraphStorage storage : {GraphStorage::Sparse, GraphStorage::Dense}) {
+        Graph g(5, storage);
+        g.addEdge(0, 1, 2);
+        g.addEdge(1, 2, 2);
+        g.addEdge(0, 2, 7);
+        g.addEdge(3, 4, 1);
+        g.selectLandmarks(2);
+        g.enableRouteCache(4);
+        EXPECT_EQ(g.findShortestPath(0, 2).first, 4);
+
+        // Slowing a road takes effect even though addEdge would keep the lighter weight
+        unsigned long long before = g.getVersion();
+        g.setEdgeWeight(2, 1, 9);
+        EXPECT_GT(g.getVersion(), before);
+        EXPECT_EQ(g.getEdgeWeight(1, 2), 9);
+        EXPECT_EQ(g.getMaxEdgeWeight(), 9);
+        EXPECT_EQ(g.findShortestPath(0, 2).first, 7);
+        EXPECT_EQ(g.findShortestPath(0, 2, ShortestPathEngine::AStarLandmarks).first, 7);
+
+        EXPECT_TRUE(g.removeEdge(2, 0));
+        EXPECT_FALSE(g.removeEdge(0, 2));
+        EXPECT_FALSE(g.removeEdge(3, 3));
+        EXPECT_EQ(g.getEdgeWeight(0, 2), std::numeric_limits<int>::max());
+        EXPECT_EQ(g.getEdgeCount(), 3);
+        EXPECT_EQ(g.findShortestPath(0, 2).first, 11);
+
+        // Closing the last road between two parts splits the component index
+        EXPECT_EQ(g.getComponentCount(), 2);
+        EXPECT_TRUE(g.removeEdge(1, 2));
+        EXPECT_EQ(g.getComponentCount(), 3);
+        EXPECT_FALSE(g.isConnected(0, 2));
+        EXPECT_EQ(g.findShortestPath(0, 2).first, std::numeric_limits<int>::max());
+        EXPECT_TRUE(g.isConnected(4, 3));
+
+        EXPECT_THROW(g.setEdgeWeight(0, 2, 1), std::invalid_argument);
+        EXPECT_THROW(g.setEdgeWeight(1, 1, 1), std::invalid_argument);
+        EXPECT_THROW(g.removeEdge(0, 5), std::out_of_range);
+    }
+}
+
+TEST(RoadClosureTest, PendingEdgesAndBulkBuild) {
+    Graph bulk = Graph::fromEdges(6, std::vector<Graph::Edge>{{0, 1, 1}, {1, 2, 1}, {2, 3, 1}, {3, 4, 1}});
+    bulk.addEdge(4, 5, 2);  // still pending when the closure arrives
+    EXPECT_TRUE(bulk.removeEdge(1, 2));
+    EXPECT_EQ(bulk.getComponentCount(), 2);
+    EXPECT_EQ(bulk.findShortestPath(2, 5).first, 4);
+    EXPECT_EQ(bulk.findShortestPath(0, 5).first, std::numeric_limits<int>::max());
+
+    std::vector<int> row;
+    bulk.forEachNeighbor(3, [&](int v, int) { row.push_back(v); });
+    EXPECT_EQ(row, std::vector<int>({2, 4}));
+    bulk.forEachNeighbor(1, [&](int v, int) { EXPECT_EQ(v, 0); });
+
+    bulk.setEdgeWeight(5, 4, 1);
+    EXPECT_EQ(bulk.findShortestPath(2, 5).first, 3);
+}
+
+TEST(DistanceTableTest, MatchesPointQueriesInEitherOrientation) {
+    const int n = 250;
+    Graph g(n + 1);  // vertex n stays isolated
+    srand(53);
+    for (int i = 0; i < 900; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 40 + 1);
+    }
+
+    std::vector<int> few = {3, n, 77};
+    std::vector<int> many = {0, 12, 12, 199, 249, n, 140};
+    // Wide tables search from the sources, tall tables from the targets
+    for (const auto& shape : {std::make_pair(few, many), std::make_pair(many, few)}) {
+        const std::vector<int>& sources = shape.first;
+        const std::vector<int>& targets = shape.second;
+        std::vector<int> table = g.computeDistanceTable(sources, targets, 2);
+        ASSERT_EQ(table.size(), sources.size() * targets.size());
+        for (size_t i = 0; i < sources.size(); ++i) {
+            for (size_t j = 0; j < targets.size(); ++j) {
+                EXPECT_EQ(table[i * targets.size() + j], g.findShortestPath(sources[i], targets[j]).first);
+            }
+        }
+    }
+
+    EXPECT_EQ(g.computeDistanceTable({5}, {5}), std::vector<int>({0}));
+    EXPECT_TRUE(g.computeDistanceTable({}, many).empty());
+    EXPECT_THROW(g.computeDistanceTable({0}, {n + 1}), std::out_of_range);
+}
+
+TEST(DistanceOnlyTest, MatchesPathQueriesForEveryEngine) {
+    const int n = 200;
+    Graph g(n + 1);  // vertex n stays isolated
+    srand(59);
+    for (int i = 0; i < 700; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 30 + 1);
+    }
+    g.selectLandmarks(3);
+
+    for (ShortestPathEngine engine : {ShortestPathEngine::LinearScan, ShortestPathEngine::BinaryHeap,
+                                      ShortestPathEngine::AStarLandmarks, ShortestPathEngine::Bidirectional}) {
+        for (int q = 0; q < 60; ++q) {
+            int s = rand() % (n + 1), t = rand() % (n + 1);
+            SearchStats pathStats, distanceStats;
+            int expected = g.findShortestPath(s, t, engine, &pathStats).first;
+            ASSERT_EQ(g.findShortestDistance(s, t, engine, &distanceStats), expected);
+            EXPECT_EQ(distanceStats.settledVertices, pathStats.settledVertices);
+        }
+    }
+    EXPECT_EQ(g.findShortestDistance(4, 4), 0);
+    EXPECT_THROW(g.findShortestDistance(0, n + 1), std::out_of_range);
+
+    // Paths requested afterwards on the same thread are unaffected
+    auto route = g.findShortestPath(0, 1);
+    if (!route.second.empty()) {
+        EXPECT_EQ(route.second.front(), 0);
+    }
+}
+
+TEST(DistanceOnlyTest, BatchMatchesPathBatch) {
+    const int n = 300;
+    Graph g(n + 1);
+    srand(61);
+    for (int i = 0; i < 1000; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 30 + 1);
+    }
+    std::vector<std::pair<int, int>> queries;
+    for (int q = 0; q < 150; ++q) {
+        queries.push_back({rand() % 10, rand() % (n + 1)});  // shared sources
+    }
+    queries.push_back({n, 3});
+    queries.push_back({7, 7});
+
+    std::vector<int> distances = g.findShortestDistances(queries, 3);
+    auto paths = g.findShortestPaths(queries, 3);
+    ASSERT_EQ(distances.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(distances[i], paths[i].first) << queries[i].first << " -> " << queries[i].second;
+    }
+    EXPECT_TRUE(g.findShortestDistances({}).empty());
+
+    Graph dense(3, GraphStorage::Dense);
+    dense.addEdge(0, 1, 4);
+    dense.addEdge(1, 2, 5);
+    EXPECT_EQ(dense.findShortestDistances({{0, 2}, {0, 1}, {2, 2}}), std::vector<int>({9, 4, 0}));
+}
+
+TEST(DistanceOnlyTest, DenseLinearScanMatchesPathQueries) {
+    const int n = 120;
+    Graph dense(n, GraphStorage::Dense);
+    srand(67);
+    for (int i = 0; i < 900; ++i) {
+        dense.addEdge(rand() % n, rand() % n, rand() % 30 + 1);
+    }
+
+    for (int q = 0; q < 40; ++q) {
+        int s = rand() % n, t = rand() % n;
+        SearchStats pathStats, distanceStats;
+        int expected = dense.findShortestPath(s, t, ShortestPathEngine::Auto, &pathStats).first;
+        ASSERT_EQ(dense.findShortestDistance(s, t, ShortestPathEngine::Auto, &distanceStats), expected);
+        EXPECT_EQ(distanceStats.settledVertices, pathStats.settledVertices);
+        EXPECT_EQ(distanceStats.relaxedEdges, pathStats.relaxedEdges);
+    }
+}
+
+TEST(BetweennessTest, PathAndDiamond) {
+    // 0 - 1 - 2 - 3 - 4: a vertex carries (cities left) x (cities right) pairs
+    Graph path(5);
+    for (int v = 0; v < 4; ++v) path.addEdge(v, v + 1, 3);
+    BetweennessScores line = path.computeBetweenness(2);
+    EXPECT_EQ(line.vertexScores, std::vector<double>({0, 3, 4, 3, 0}));
+    EXPECT_EQ(line.edges, (std::vector<std::pair<int, int>>{{0, 1}, {1, 2}, {2, 3}, {3, 4}}));
+    EXPECT_EQ(line.edgeScores, std::vector<double>({4, 6, 6, 4}));
+    EXPECT_EQ(line.sourcesUsed, 5);
+
+    // Two equal routes around a square split every opposite pair in half
+    for (GraphStorage storage : {GraphStorage::Sparse, GraphStorage::Dense}) {
+        Graph square(5, storage);  // vertex 4 is isolated
+        square.addEdge(0, 1, 1);
+        square.addEdge(1, 3, 3);
+        square.addEdge(0, 2, 3);
+        square.addEdge(2, 3, 1);
+        BetweennessScores scores = square.computeBetweenness(1);
+        EXPECT_EQ(scores.vertexScores, std::vector<double>({0.5, 0.5, 0.5, 0.5, 0}));
+        EXPECT_EQ(scores.edgeScores, std::vector<double>({2, 2, 2, 2}));
+    }
+
+    // Zero-weight roads tie many routes without creating cycles
+    Graph zero(3);
+    zero.addEdge(0, 1, 0);
+    zero.addEdge(1, 2, 0);
+    EXPECT_EQ(zero.computeBetweenness().vertexScores, std::vector<double>({0, 1, 0}));
+
+    EXPECT_TRUE(Graph(0).computeBetweenness().vertexScores.empty());
+}
+
+TEST(BetweennessTest, OverflowingRoadsAreNeverRoutes) {
+    // 1 - 2 directly would overflow an int route from 0, so 1 -> 0 -> 2 is the only shortest route
+    const int big = std::numeric_limits<int>::max() - 5;
+    Graph triangle(3);
+    triangle.addEdge(0, 1, 10);
+    triangle.addEdge(1, 2, big);
+    triangle.addEdge(0, 2, 20);
+    BetweennessScores scores = triangle.computeBetweenness(2);
+    EXPECT_EQ(scores.vertexScores, std::vector<double>({1, 0, 0}));
+    EXPECT_EQ(scores.edgeScores, std::vector<double>({2, 2, 0}));
+
+    // City 2 is reachable from 0 only by a route longer than an int holds
+    Graph tail(4);
+    tail.addEdge(0, 1, 10);
+    tail.addEdge(1, 2, big);
+    tail.addEdge(0, 3, 20);
+    EXPECT_THROW(tail.computeBetweenness(1), std::overflow_error);
+}
+
+TEST(BetweennessTest, MatchesBruteForceForAnyThreadCount) {
+    const int n = 40;
+    Graph g(n);
+    srand(83);
+    for (int i = 0; i < 90; ++i) {
+        g.addEdge(rand() % n, rand() % n, rand() % 4 + 1);  // small weights create ties
+    }
+
+    // Count shortest routes from every source, settling vertices by distance
+    std::vector<int> dist = g.computeAllPairsDistances(1);
+    std::vector<double> count(n * n, 0.0);
+    for (int s = 0; s < n; ++s) {
+        std::vector<int> byDistance(n);
+        std::iota(byDistance.begin(), byDistance.end(), 0);
+        std::sort(byDistance.begin(), byDistance.end(), [&](int a, int b) { return dist[s * n + a] < dist[s * n + b]; });
+        count[s * n + s] = 1;
+        for (int t : byDistance) {
+            if (t == s || dist[s * n + t] == std::numeric_limits<int>::max()) continue;
+            g.forEachNeighbor(t, [&](int u, int w) {
+                if (dist[s * n + u] != std::numeric_limits<int>::max() && dist[s * n + u] + w == dist[s * n + t]) {
+                    count[s * n + t] += count[s * n + u];
+                }
+            });
+        }
+    }
+
+    std::vector<double> expectedVertex(n, 0.0);
+    for (int s = 0; s < n; ++s) {
+        for (int t = s + 1; t < n; ++t) {
+            if (dist[s * n + t] == std::numeric_limits<int>::max()) continue;
+            for (int v = 0; v < n; ++v) {
+                if (v == s || v == t || dist[s * n + v] == std::numeric_limits<int>::max()) continue;
+                if (dist[s * n + v] + dist[v * n + t] == dist[s * n + t]) {
+                    expectedVertex[v] += count[s * n + v] * count[v * n + t] / count[s * n + t];
+                }
+            }
+        }
+    }
+
+    BetweennessScores reference = g.computeBetweenness(1);
+    for (int v = 0; v < n; ++v) {
+        EXPECT_NEAR(reference.vertexScores[v], expectedVertex[v], 1e-9) << "vertex " << v;
+    }
+    ASSERT_EQ(reference.edges.size(), static_cast<size_t>(g.getEdgeCount()));
+    for (size_t i = 0; i < reference.edges.size(); ++i) {
+        auto [a, b] = reference.edges[i];
+        int w = g.getEdgeWeight(a, b);
+        double expected = 0;
+        for (int s = 0; s < n; ++s) {
+            for (int t = s + 1; t < n; ++t) {
+                if (dist[s * n + t] == std::numeric_limits<int>::max()) continue;
+                for (auto [u, v] : {std::make_pair(a, b), std::make_pair(b, a)}) {
+                    if (dist[s * n + u] != std::numeric_limits<int>::max() && dist[v * n + t] != std::numeric_limits<int>::max()
+                        && dist[s * n + u] + w + dist[v * n + t] == dist[s * n + t]) {
+                        expected += count[s * n + u] * count[v * n + t] / count[s * n + t];
+                    }
+                }
+            }
+        }
+        EXPECT_NEAR(reference.edgeScores[i], expected, 1e-9) << a << " - " << b;
+    }
+
+    // Per-thread accumulators reduce to the same totals
+    for (unsigned threads : {2u, 3u, 8u}) {
+        BetweennessScores parallel = g.computeBetweenness(threads);
+        EXPECT_EQ(parallel.edges, reference.edges);
+        for (int v = 0; v < n; ++v) EXPECT_NEAR(parallel.vertexScores[v], reference.vertexScores[v], 1e-9);
+        for (size_t i = 0; i < reference.edgeScores.size(); ++i) {
+            EXPECT_NEAR(parallel.edgeScores[i], reference.edgeScores[i], 1e-9);
+        }
+    }
+}
+
+TEST(BetweennessTest, SampledEstimate) {
+    const int side = 20;
+    Graph g = makeGridNetwork(side, 89);
+    BetweennessScores exact = g.computeBetweenness(2);
+    BetweennessScores sampled = g.estimateBetweenness(100, 2, 7);
+    EXPECT_EQ(sampled.sourcesUsed, 100);
+    EXPECT_EQ(sampled.edges, exact.edges);
+
+    // Totals are estimated without bias; the busiest roads stay near the top
+    double exactTotal = std::accumulate(exact.edgeScores.begin(), exact.edgeScores.end(), 0.0);
+    double sampledTotal = std::accumulate(sampled.edgeScores.begin(), sampled.edgeScores.end(), 0.0);
+    EXPECT_NEAR(sampledTotal / exactTotal, 1.0, 0.15);
+    size_t busiest = std::max_element(exact.edgeScores.begin(), exact.edgeScores.end()) - exact.edgeScores.begin();
+    std::vector<double> ranked = sampled.edgeScores;
+    std::sort(ranked.rbegin(), ranked.rend());
+    EXPECT_GE(sampled.edgeScores[busiest], ranked[ranked.size() / 20]);
+
+    BetweennessScores full = g.estimateBetweenness(side * side, 1);
+    EXPECT_EQ(full.sourcesUsed, side * side);
+    for (size_t i = 0; i < full.edgeScores.size(); ++i) EXPECT_NEAR(full.edgeScores[i], exact.edgeScores[i], 1e-6);
+    EXPECT_THROW(g.estimateBetweenness(0), std::invalid_argument);
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "SimdKernels.h"
+
+/**
+ * @brief Builds a side x side grid road network with random weights
+ * @param side Cities per row and column
+ * @param seed Seed for srand, so each test gets a fixed network
+ * @param maxWeight Road weights are drawn from [1, maxWeight]
+ */
+inline Graph makeGridNetwork(int side, unsigned seed, int maxWeight = 9) {
+    std::vector<Graph::Edge> edges;
+    srand(seed);
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            if (c + 1 < side) edges.push_back({v, v + 1, rand() % maxWeight + 1});
+            if (r + 1 < side) edges.push_back({v, v + side, rand() % maxWeight + 1});
+        }
+    }
+    return Graph::fromEdges(side * side, edges);
+}
+
+/**
+ * @brief Builds a grid road network whose city ids are shuffled, as in survey-order input files
+ */
+inline Graph makeShuffledGrid(int side, unsigned seed) {
+    const int n = side * side;
+    std::vector<int> id(n);
+    std::iota(id.begin(), id.end(), 0);
+    srand(seed);
+    for (int i = n - 1; i > 0; --i) std::swap(id[i], id[rand() % (i + 1)]);
+
+    std::vector<Graph::Edge> edges;
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            if (c + 1 < side) edges.push_back({id[v], id[v + 1], rand() % 9 + 1});
+            if (r + 1 < side) edges.push_back({id[v], id[v + side], rand() % 9 + 1});
+        }
+    }
+    return Graph::fromEdges(n, edges);
+}
+
+/**
+ * @brief Builds an adjacency-matrix graph where about a quarter of all city pairs have a road
+ */
+inline Graph makeDenseGraph(int n, unsigned seed) {
+    srand(seed);
+    Graph g(n, GraphStorage::Dense);
+    for (int u = 0; u < n; ++u) {
+        for (int v = u + 1; v < n; ++v) {
+            if (rand() % 4 == 0) g.addEdge(u, v, rand() % 50 + 1);
+        }
+    }
+    return g;
+}
+
+/**
+ * @brief Builds a network of random roads between random cities
+ * @param vertices Number of cities
+ * @param edges Number of roads to draw
+ * @param maxWeight Road weights are drawn from [1, maxWeight]
+ * @param seed Seed for srand
+ */
+inline Graph makeRandomNetwork(int vertices, int edges, int maxWeight, unsigned seed) {
+    srand(seed);
+    std::vector<Graph::Edge> list(edges);
+    for (Graph::Edge& edge : list) {
+        edge = {rand() % vertices, rand() % vertices, rand() % maxWeight + 1};
+    }
+    return Graph::fromEdges(vertices, list);
+}
+
+/**
+ * @brief Gets a path for a scratch file in gtest's temporary directory
+ */
+inline std::string tempPath(const std::string& name) {
+    return ::testing::TempDir() + name;
+}
+
+/**
+ * @brief Gets every SIMD level this CPU can run, scalar first
+ */
+inline std::vector<SimdKernels::Level> supportedLevels() {
+    std::vector<SimdKernels::Level> levels;
+    for (SimdKernels::Level level : {SimdKernels::Level::Scalar, SimdKernels::Level::SSE, SimdKernels::Level::AVX2}) {
+        if (static_cast<int>(level) <= static_cast<int>(SimdKernels::bestSupportedLevel())) {
+            levels.push_back(level);
+        }
+    }
+    return levels;
+}
+
+// Restores the automatically chosen SIMD level when a test finishes
+struct LevelGuard {
+    SimdKernels::Level saved = SimdKernels::getLevel();
+    ~LevelGuard() { SimdKernels::setLevel(saved); }
+};
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "HubLabels.h"
+#include "test_helpers.h"
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+TEST(HubLabelsTest, MatchesDijkstraForBothOrders) {
+    const int n = 250;
+    Graph graph(n);
+    srand(41);
+    for (int i = 0; i < 700; ++i) {
+        graph.addEdge(rand() % n, rand() % n, rand() % 50 + 1);
+    }
+
+    for (HubOrder order : {HubOrder::Degree, HubOrder::ContractionHierarchy}) {
+        HubLabels labels(graph, order);
+        EXPECT_EQ(labels.getVertexCount(), n);
+        EXPECT_GE(labels.getAverageLabelSize(), 1.0);
+        for (int s = 0; s < n; s += 7) {
+            ShortestPathTree tree = graph.computeShortestPathTree(s);
+            for (int t = 0; t < n; ++t) {
+                ASSERT_EQ(labels.findShortestDistance(s, t), tree.distanceTo(t)) << s << " -> " << t;
+            }
+        }
+        EXPECT_EQ(labels.crossCheck(graph, 300, 5), 0);
+    }
+}
+
+TEST(HubLabelsTest, DisconnectedAndInvalidQueries) {
+    Graph graph(5);
+    graph.addEdge(0, 1, 4);
+    graph.addEdge(1, 2, 3);
+    graph.addEdge(3, 4, 2);
+
+    HubLabels labels(graph);
+    EXPECT_EQ(labels.findShortestDistance(0, 2), 7);
+    EXPECT_EQ(labels.findShortestDistance(2, 2), 0);
+    EXPECT_EQ(labels.findShortestDistance(4, 3), 2);
+    EXPECT_EQ(labels.findShortestDistance(0, 4), INT_MAX);
+    EXPECT_THROW(labels.findShortestDistance(-1, 0), std::out_of_range);
+    EXPECT_THROW(labels.findShortestDistance(0, 5), std::out_of_range);
+    EXPECT_THROW(labels.crossCheck(Graph(4), 10), std::invalid_argument);
+
+    HubLabels empty{Graph(0)};
+    EXPECT_EQ(empty.getEntryCount(), 0u);
+    EXPECT_EQ(empty.getAverageLabelSize(), 0.0);
+}
+
+TEST(HubLabelsTest, SaveAndLoadRoundTrip) {
+    Graph graph = makeGridNetwork(12, 3);
+    HubLabels built(graph, HubOrder::ContractionHierarchy);
+    const std::string path = tempPath("grid.rchl");
+    built.save(path);
+
+    HubLabels loaded = HubLabels::load(path);
+    EXPECT_EQ(loaded.getVertexCount(), built.getVertexCount());
+    EXPECT_EQ(loaded.getEntryCount(), built.getEntryCount());
+    EXPECT_EQ(loaded.getMemoryBytes(), built.getMemoryBytes());
+    for (int s = 0; s < graph.getVertexCount(); s += 5) {
+        for (int t = 0; t < graph.getVertexCount(); t += 3) {
+            ASSERT_EQ(loaded.findShortestDistance(s, t), built.findShortestDistance(s, t));
+        }
+    }
+    EXPECT_EQ(loaded.crossCheck(graph, 100), 0);
+    std::remove(path.c_str());
+}
+
+TEST(HubLabelsTest, RejectsMissingOrCorruptFiles) {
+    EXPECT_THROW(HubLabels::load(tempPath("does_not_exist.rchl")), std::runtime_error);
+
+    const std::string path = tempPath("corrupt.rchl");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not a label file at all, just some text";
+    }
+    EXPECT_THROW(HubLabels::load(path), std::runtime_error);
+
+    // A valid header with the entries cut off
+    Graph graph(3);
+    graph.addEdge(0, 1, 1);
+    HubLabels(graph).save(path);
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size() - 8);
+    }
+    EXPECT_THROW(HubLabels::load(path), std::runtime_error);
+    std::remove(path.c_str());
+}
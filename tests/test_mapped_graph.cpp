@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "MappedGraph.h"
+#include "test_helpers.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+TEST(MappedGraphTest, RoundTripsAndAnswersQueriesInPlace) {
+    Graph g(50);
+    srand(13);
+    for (int i = 0; i < 200; ++i) {
+        g.addEdge(rand() % 50, rand() % 50, rand() % 20 + 1);
+    }
+    const std::string path = tempPath("roundtrip.rcg");
+    MappedGraph::write(g, path);
+
+    MappedGraph mapped(path);
+    EXPECT_EQ(mapped.getVertexCount(), g.getVertexCount());
+    EXPECT_EQ(mapped.getEdgeCount(), g.getEdgeCount());
+    for (int u = 0; u < 50; ++u) {
+        for (int v = 0; v < 50; ++v) {
+            ASSERT_EQ(mapped.getEdgeWeight(u, v), g.getEdgeWeight(u, v));
+        }
+    }
+    for (int source = 0; source < 50; source += 7) {
+        EXPECT_EQ(mapped.computeShortestPathTree(source).getDistances(),
+                  g.computeShortestPathTree(source).getDistances());
+        EXPECT_EQ(mapped.findShortestPath(source, 49).first, g.findShortestPath(source, 49).first);
+    }
+    EXPECT_THROW(mapped.findShortestPath(0, 50), std::out_of_range);
+    std::remove(path.c_str());
+}
+
+TEST(MappedGraphTest, ConvertsTextNetwork) {
+    const std::string textPath = tempPath("network.txt");
+    const std::string binaryPath = tempPath("network.rcg");
+    {
+        std::ofstream text(textPath);
+        text << "4 4\n0 1 5\n1 2 3\n2 3 2\n0 3 20\n0 3\n";
+    }
+    MappedGraph::convertText(textPath, binaryPath);
+
+    MappedGraph mapped(binaryPath);
+    auto route = mapped.findShortestPath(0, 3);
+    EXPECT_EQ(route.first, 10);
+    EXPECT_EQ(route.second, std::vector<int>({0, 1, 2, 3}));
+
+    int degree = 0;
+    mapped.forEachNeighbor(0, [&](int, int) { ++degree; });
+    EXPECT_EQ(degree, 2);
+
+    {
+        std::ofstream text(textPath);
+        text << "3 1\n0 7 5\n";
+    }
+    EXPECT_THROW(MappedGraph::convertText(textPath, binaryPath), std::runtime_error);
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+}
+
+TEST(MappedGraphTest, RejectsMissingOrCorruptFiles) {
+    EXPECT_THROW(MappedGraph(tempPath("does_not_exist.rcg")), std::runtime_error);
+
+    const std::string path = tempPath("corrupt.rcg");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not a graph file at all, just some text";
+    }
+    EXPECT_THROW(MappedGraph{path}, std::runtime_error);
+
+    // A valid header with the arrays cut off
+    Graph g(3);
+    g.addEdge(0, 1, 1);
+    MappedGraph::write(g, path);
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size() - 4);
+    }
+    EXPECT_THROW(MappedGraph{path}, std::runtime_error);
+
+    // Right size, but offsets or neighbor ids that would read out of bounds
+    MappedGraph::write(g, path);
+    std::string valid;
+    {
+        std::ifstream in(path, std::ios::binary);
+        valid.assign((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    }
+    const size_t offsetsAt = 32, neighborsAt = offsetsAt + 4 * sizeof(std::int32_t);
+    auto corrupt = [&](size_t at, std::int32_t value) {
+        std::string bytes = valid;
+        std::memcpy(&bytes[at], &value, sizeof(value));
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size());
+    };
+    corrupt(offsetsAt, 1);                           // first row must start at 0
+    EXPECT_THROW(MappedGraph{path}, std::runtime_error);
+    corrupt(offsetsAt + 2 * sizeof(std::int32_t), 0);  // row 2 ending before row 1
+    EXPECT_THROW(MappedGraph{path}, std::runtime_error);
+    corrupt(offsetsAt + 3 * sizeof(std::int32_t), 7);  // last offset past the arcs
+    EXPECT_THROW(MappedGraph{path}, std::runtime_error);
+    corrupt(neighborsAt, 3);                         // neighbor id == vertex count
+    EXPECT_THROW(MappedGraph{path}, std::runtime_error);
+    corrupt(neighborsAt, -1);
+    EXPECT_THROW(MappedGraph{path}, std::runtime_error);
+    corrupt(neighborsAt + 4, 2);                     // still in range, so accepted
+    EXPECT_NO_THROW(MappedGraph{path});
+    std::remove(path.c_str());
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "BucketQueue.h"
+#include "RadixHeap.h"
+#include "Graph.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace {
+
+// Simulates a Dijkstra frontier: pushes never go below the last popped key
+template<typename PriorityQueue>
+std::vector<int> drainMonotone(PriorityQueue& queue, int maxStep, unsigned seed) {
+    srand(seed);
+    std::vector<int> popped;
+    queue.push(0, 0);
+    int pushed = 1;
+    while (!queue.empty()) {
+        auto [key, vertex] = queue.pop();
+        EXPECT_GE(vertex, 0);
+        popped.push_back(key);
+        for (int k = 0; k < 3 && pushed < 2000; ++k, ++pushed) {
+            queue.push(key + rand() % (maxStep + 1), pushed);
+        }
+    }
+    return popped;
+}
+
+}  // namespace
+
+TEST(BucketQueueTest, PopsInNonDecreasingKeyOrder) {
+    BucketQueue queue(7);
+    std::vector<int> popped = drainMonotone(queue, 7, 3);
+    EXPECT_EQ(popped.size(), 2000u);
+    EXPECT_TRUE(std::is_sorted(popped.begin(), popped.end()));
+    EXPECT_THROW(queue.pop(), std::underflow_error);
+    EXPECT_THROW(queue.reset(-1), std::invalid_argument);
+}
+
+TEST(BucketQueueTest, ZeroWeightsAndReuseAfterEarlyExit) {
+    BucketQueue queue(0);
+    queue.push(0, 1);
+    queue.push(0, 2);
+    EXPECT_EQ(queue.pop().first, 0);
+    queue.push(0, 3);
+    EXPECT_EQ(queue.size(), 2u);
+
+    // Entries left behind by an abandoned search are discarded by reset
+    queue.reset(5);
+    EXPECT_TRUE(queue.empty());
+    queue.push(4, 9);
+    queue.push(2, 8);
+    EXPECT_EQ(queue.pop(), std::make_pair(2, 8));
+    EXPECT_EQ(queue.pop(), std::make_pair(4, 9));
+}
+
+TEST(RadixHeapTest, PopsInNonDecreasingKeyOrder) {
+    RadixHeap heap;
+    std::vector<int> popped = drainMonotone(heap, 1000000, 5);
+    EXPECT_EQ(popped.size(), 2000u);
+    EXPECT_TRUE(std::is_sorted(popped.begin(), popped.end()));
+    EXPECT_THROW(heap.pop(), std::underflow_error);
+
+    heap.push(7, 1);
+    heap.reset();
+    EXPECT_TRUE(heap.empty());
+    heap.push(std::numeric_limits<int>::max() - 1, 4);
+    heap.push(3, 5);
+    EXPECT_EQ(heap.pop(), std::make_pair(3, 5));
+    EXPECT_EQ(heap.pop(), std::make_pair(std::numeric_limits<int>::max() - 1, 4));
+}
+
+TEST(MonotoneQueueEngineTest, AutoSelectsByMaxWeight) {
+    Graph small(3);
+    EXPECT_EQ(small.getMaxEdgeWeight(), 0);
+    small.addEdge(0, 1, 12);
+    small.addEdge(0, 1, 5);  // lowering a road keeps the recorded maximum
+    EXPECT_EQ(small.getMaxEdgeWeight(), 12);
+
+    Graph wide = Graph::fromEdges(3, std::vector<Graph::Edge>{{0, 1, 2}, {1, 2, Graph::BUCKET_QUEUE_WEIGHT_LIMIT + 1}});
+    EXPECT_EQ(wide.getMaxEdgeWeight(), Graph::BUCKET_QUEUE_WEIGHT_LIMIT + 1);
+
+    // Identical work counters show which queue Auto resolved to
+    for (Graph* g : {&small, &wide}) {
+        ShortestPathEngine expected = g == &small ? ShortestPathEngine::BucketQueue : ShortestPathEngine::RadixHeap;
+        SearchStats autoStats, explicitStats;
+        auto viaAuto = g->findShortestPath(0, 2, ShortestPathEngine::Auto, &autoStats);
+        auto viaExplicit = g->findShortestPath(0, 2, expected, &explicitStats);
+        EXPECT_EQ(viaAuto, viaExplicit);
+        EXPECT_EQ(autoStats.settledVertices, explicitStats.settledVertices);
+        EXPECT_EQ(autoStats.relaxedEdges, explicitStats.relaxedEdges);
+    }
+    EXPECT_EQ(wide.findShortestPath(0, 2).first, Graph::BUCKET_QUEUE_WEIGHT_LIMIT + 3);
+}
+
+TEST(MonotoneQueueEngineTest, MatchesBinaryHeap) {
+    for (int maxWeight : {1, 9, 100, 100000}) {
+        Graph g = makeRandomNetwork(400, 1400, maxWeight, 7 + maxWeight);
+        for (int s = 0; s < 400; s += 57) {
+            std::vector<int> expected = g.computeShortestPathTree(s, ShortestPathEngine::BinaryHeap).getDistances();
+            for (ShortestPathEngine engine : {ShortestPathEngine::BucketQueue, ShortestPathEngine::RadixHeap}) {
+                ShortestPathTree tree = g.computeShortestPathTree(s, engine);
+                ASSERT_EQ(tree.getDistances(), expected);
+
+                for (int t = 0; t < 400; t += 31) {
+                    auto route = g.findShortestPath(s, t, engine);
+                    ASSERT_EQ(route.first, expected[t]);
+                    EXPECT_EQ(g.findShortestDistance(s, t, engine), expected[t]);
+                    if (route.second.empty()) continue;
+                    int length = 0;
+                    for (size_t i = 1; i < route.second.size(); ++i) {
+                        length += g.getEdgeWeight(route.second[i - 1], route.second[i]);
+                    }
+                    EXPECT_EQ(length, route.first);
+                }
+            }
+        }
+    }
+}
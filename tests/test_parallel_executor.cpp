@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include "ParallelExecutor.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(ParallelExecutorTest, VisitsEveryIndexOnce) {
+    ParallelExecutor executor(4);
+    EXPECT_EQ(executor.getThreadCount(), 4u);
+
+    std::vector<std::atomic<int>> hits(1000);
+    std::atomic<bool> workerInRange(true);
+    executor.parallelFor(hits.size(), [&](size_t i, unsigned worker) {
+        if (worker >= 4u) workerInRange = false;
+        ++hits[i];
+    });
+    EXPECT_TRUE(workerInRange.load());
+    for (const auto& hit : hits) {
+        EXPECT_EQ(hit.load(), 1);
+    }
+
+    std::atomic<int> total(0);
+    executor.parallelFor(0, [&](size_t, unsigned) { ++total; });
+    executor.parallelFor(3, [&](size_t, unsigned) { ++total; });
+    EXPECT_EQ(total.load(), 3);
+}
+
+TEST(ParallelExecutorTest, RethrowsWorkerException) {
+    ParallelExecutor executor(2);
+    EXPECT_THROW(executor.parallelFor(100, [](size_t i, unsigned) {
+        if (i == 37) throw std::runtime_error("boom");
+    }), std::runtime_error);
+    EXPECT_GE(ParallelExecutor().getThreadCount(), 1u);
+}
+
+TEST(ParallelExecutorTest, RegionRunsEveryWorkerConcurrently) {
+    ParallelExecutor executor(3);
+    std::vector<std::atomic<int>> calls(3);
+    std::atomic<unsigned> arrived(0);
+    executor.parallelRegion([&](unsigned worker) {
+        ++calls[worker];
+        // Would spin forever if two workers shared a thread
+        ++arrived;
+        while (arrived.load() < 3u) std::this_thread::yield();
+    });
+    for (const auto& call : calls) {
+        EXPECT_EQ(call.load(), 1);
+    }
+}
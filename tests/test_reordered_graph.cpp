@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "ReorderedGraph.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+
+TEST(ReorderedGraphTest, ResultsUseOriginalIds) {
+    Graph g = makeShuffledGrid(15, 3);
+    // A second component and an isolated vertex are renumbered too
+    Graph withExtras = Graph::fromEdges(g.getVertexCount() + 3, {{225, 226, 4}});
+    for (int u = 0; u < g.getVertexCount(); ++u) {
+        g.forEachNeighbor(u, [&](int v, int w) { if (u < v) withExtras.addEdge(u, v, w); });
+    }
+
+    for (VertexOrder order : {VertexOrder::BreadthFirst, VertexOrder::ReverseCuthillMcKee}) {
+        ReorderedGraph reordered(withExtras, order);
+        const int n = withExtras.getVertexCount();
+        for (int v = 0; v < n; ++v) {
+            ASSERT_EQ(reordered.toOriginal(reordered.toInternal(v)), v);
+        }
+
+        for (int source : {0, 17, 120, 225}) {
+            ShortestPathTree expected = withExtras.computeShortestPathTree(source);
+            ShortestPathTree actual = reordered.computeShortestPathTree(source);
+            EXPECT_EQ(actual.getSource(), source);
+            ASSERT_EQ(actual.getDistances(), expected.getDistances());
+
+            for (int target : {3, 99, 226, 227}) {
+                auto route = reordered.findShortestPath(source, target);
+                EXPECT_EQ(route.first, expected.distanceTo(target));
+                if (!route.second.empty()) {
+                    EXPECT_EQ(route.second.front(), source);
+                    EXPECT_EQ(route.second.back(), target);
+                    int length = 0;
+                    for (size_t i = 1; i < route.second.size(); ++i) {
+                        length += withExtras.getEdgeWeight(route.second[i - 1], route.second[i]);
+                    }
+                    EXPECT_EQ(length, route.first);
+                }
+            }
+        }
+        EXPECT_THROW(reordered.toInternal(n), std::out_of_range);
+    }
+}
+
+TEST(ReorderedGraphTest, ReverseCuthillMcKeeNarrowsNeighborGap) {
+    Graph g = makeShuffledGrid(30, 5);
+    ReorderedGraph bfs(g, VertexOrder::BreadthFirst);
+    ReorderedGraph rcm(g, VertexOrder::ReverseCuthillMcKee);
+
+    double shuffled = ReorderedGraph::averageNeighborGap(g);
+    EXPECT_LT(ReorderedGraph::averageNeighborGap(bfs.getGraph()), shuffled / 5);
+    EXPECT_LT(ReorderedGraph::averageNeighborGap(rcm.getGraph()), shuffled / 5);
+    EXPECT_EQ(ReorderedGraph::averageNeighborGap(Graph(4)), 0.0);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "SimdKernels.h"
+#include "Graph.h"
+#include "test_helpers.h"
+#include <climits>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int INF = INT_MAX;
+
+}  // namespace
+
+TEST(SimdKernelsTest, EveryLevelMatchesScalar) {
+    LevelGuard guard;
+    srand(11);
+    // Sizes around the 4- and 8-lane widths exercise the scalar tails
+    for (size_t count = 0; count < 40; ++count) {
+        std::vector<int> distance(count), open(count), row(count), previous(count);
+        for (size_t j = 0; j < count; ++j) {
+            distance[j] = rand() % 3 == 0 ? INF : rand() % 100;
+            open[j] = rand() % 3 == 0 ? 0 : -1;
+            row[j] = rand() % 3 == 0 ? INF : rand() % 20;
+            previous[j] = static_cast<int>(j);
+        }
+        std::vector<int> minPlusSource(count);
+        for (size_t j = 0; j < count; ++j) minPlusSource[j] = rand() % 1000;
+
+        SimdKernels::setLevel(SimdKernels::Level::Scalar);
+        int expectedArgMin = SimdKernels::argMinOpen(distance.data(), open.data(), count);
+        std::vector<int> expectedDistance = distance, expectedPrevious = previous;
+        size_t expectedEdges = SimdKernels::relaxRow(expectedDistance.data(), expectedPrevious.data(), open.data(),
+                                                     row.data(), 30, 99, count);
+        std::vector<int> expectedMinPlus = distance;
+        for (int& d : expectedMinPlus) d = d == INF ? INF / 2 : d;
+        std::vector<int> minPlusInput = expectedMinPlus;
+        SimdKernels::minPlusRow(expectedMinPlus.data(), minPlusSource.data(), 7, count);
+
+        for (SimdKernels::Level level : supportedLevels()) {
+            SimdKernels::setLevel(level);
+            SCOPED_TRACE(std::string(SimdKernels::instructionSet()) + " count " + std::to_string(count));
+            EXPECT_EQ(SimdKernels::argMinOpen(distance.data(), open.data(), count), expectedArgMin);
+
+            std::vector<int> actualDistance = distance, actualPrevious = previous;
+            EXPECT_EQ(SimdKernels::relaxRow(actualDistance.data(), actualPrevious.data(), open.data(), row.data(),
+                                            30, 99, count), expectedEdges);
+            EXPECT_EQ(actualDistance, expectedDistance);
+            EXPECT_EQ(actualPrevious, expectedPrevious);
+
+            // Distance-only searches pass no predecessor array
+            std::vector<int> distanceOnly = distance;
+            EXPECT_EQ(SimdKernels::relaxRow(distanceOnly.data(), nullptr, open.data(), row.data(), 30, 99, count),
+                      expectedEdges);
+            EXPECT_EQ(distanceOnly, expectedDistance);
+
+            std::vector<int> actualMinPlus = minPlusInput;
+            SimdKernels::minPlusRow(actualMinPlus.data(), minPlusSource.data(), 7, count);
+            EXPECT_EQ(actualMinPlus, expectedMinPlus);
+        }
+    }
+}
+
+TEST(SimdKernelsTest, ArgMinOpenSkipsSettledAndPrefersLowestIndex) {
+    LevelGuard guard;
+    for (SimdKernels::Level level : supportedLevels()) {
+        SimdKernels::setLevel(level);
+        SCOPED_TRACE(SimdKernels::instructionSet());
+
+        std::vector<int> distance(19, 50);
+        std::vector<int> open(19, -1);
+        distance[2] = 1;
+        open[2] = 0;  // smallest but settled
+        distance[11] = 5;
+        distance[17] = 5;
+        EXPECT_EQ(SimdKernels::argMinOpen(distance.data(), open.data(), distance.size()), 11);
+
+        std::vector<int> unreachable(19, INF);
+        EXPECT_EQ(SimdKernels::argMinOpen(unreachable.data(), open.data(), unreachable.size()), -1);
+        EXPECT_EQ(SimdKernels::argMinOpen(distance.data(), open.data(), 0), -1);
+    }
+}
+
+TEST(SimdKernelsTest, SetLevelRejectsUnsupportedLevel) {
+    LevelGuard guard;
+    EXPECT_EQ(SimdKernels::getLevel(), SimdKernels::bestSupportedLevel());
+    if (SimdKernels::bestSupportedLevel() != SimdKernels::Level::AVX2) {
+        EXPECT_THROW(SimdKernels::setLevel(SimdKernels::Level::AVX2), std::invalid_argument);
+    }
+    SimdKernels::setLevel(SimdKernels::Level::Scalar);
+    EXPECT_STREQ(SimdKernels::instructionSet(), "scalar");
+}
+
+TEST(SimdKernelsTest, DenseLinearScanIsIdenticalAtEveryLevel) {
+    LevelGuard guard;
+    Graph dense = makeDenseGraph(61, 5);
+    Graph sparse(61);
+    for (int u = 0; u < 61; ++u) {
+        dense.forEachNeighbor(u, [&](int v, int w) { if (u < v) sparse.addEdge(u, v, w); });
+    }
+
+    SimdKernels::setLevel(SimdKernels::Level::Scalar);
+    SearchStats expectedStats;
+    ShortestPathTree expected = dense.computeShortestPathTree(0, ShortestPathEngine::LinearScan, &expectedStats);
+    EXPECT_EQ(expected.getDistances(), sparse.computeShortestPathTree(0).getDistances());
+
+    for (SimdKernels::Level level : supportedLevels()) {
+        SimdKernels::setLevel(level);
+        SCOPED_TRACE(SimdKernels::instructionSet());
+        SearchStats stats;
+        ShortestPathTree actual = dense.computeShortestPathTree(0, ShortestPathEngine::LinearScan, &stats);
+        EXPECT_EQ(actual.getDistances(), expected.getDistances());
+        EXPECT_EQ(actual.getPredecessors(), expected.getPredecessors());
+        EXPECT_EQ(stats.settledVertices, expectedStats.settledVertices);
+        EXPECT_EQ(stats.relaxedEdges, expectedStats.relaxedEdges);
+
+        for (int target : {1, 30, 60}) {
+            auto route = dense.findShortestPath(0, target);
+            EXPECT_EQ(route, sparse.findShortestPath(0, target, ShortestPathEngine::LinearScan));
+        }
+    }
+}